@@ -4,11 +4,8 @@
 // Compute the coefficients for the Adams-Bashforth scheme
 void abcoefs() {
   if (nstep >= 3) {
-    realHost1d dt3Host("dt3Host",3);
-    dt3.deep_copy_to(dt3Host);
-    yakl::fence();
-    real alpha = dt3Host(nb-1) / dt3Host(na-1);
-    real beta  = dt3Host(nc-1) / dt3Host(na-1);
+    real alpha = dt3(nb-1) / dt3(na-1);
+    real beta  = dt3(nc-1) / dt3(na-1);
     ct = (2.+3.* alpha) / (6.* (alpha + beta) * beta);
     bt = -(1.+2.*(alpha + beta) * ct)/(2. * alpha);
     at = 1. - bt - ct;
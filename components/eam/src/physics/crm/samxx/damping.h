@@ -1,8 +0,0 @@
-
-#pragma once
-
-#include "samxx_const.h"
-#include "vars.h"
-
-void damping();
-
@@ -13,7 +13,7 @@ void press_rhs() {
   YAKL_SCOPE( dz            , :: dz ); 
   YAKL_SCOPE( rhow          , :: rhow ); 
   YAKL_SCOPE( rho           , :: rho ); 
-  YAKL_SCOPE( dt3           , :: dt3 );
+  YAKL_SCOPE( dtn           , :: dtn );
   YAKL_SCOPE( na            , :: na ); 
   YAKL_SCOPE( nb            , :: nb );
   YAKL_SCOPE( nc            , :: nc );
@@ -61,7 +61,7 @@ void press_rhs() {
       real rdn = rhow(k,icrm)/rho(k,icrm)*rdz;
       int jc=j+1;
       int ic=i+1;
-      real dta=1.0/dt3(na-1)/at;
+      real dta=1.0/dtn/at;
       p(k,j+offy_p,i+offx_p,icrm)=( rdx*(u(k,j+offy_u,ic+offx_u,icrm)-u(k,j+offy_u,i+offx_u,icrm))+
                                   rdy*(v(k,jc+offy_v,i+offx_v,icrm)-v(k,j+offy_v,i+offx_v,icrm))+
                                   (w(kc,j+offy_w,i+offx_w,icrm)*rup-w(k,j+offy_w,i+offx_w,icrm)*rdn) )*dta +
@@ -89,7 +89,7 @@ void press_rhs() {
       real rup = rhow(kc,icrm)/rho(k,icrm)*rdz;
       real rdn = rhow(k,icrm)/rho(k,icrm)*rdz;
       int ic=i+1;
-      real dta=1.0/dt3(na-1)/at;
+      real dta=1.0/dtn/at;
 
       p(k,j+offy_p,i+offx_p,icrm)=(rdx*(u(k,j+offy_u,ic+offx_u,icrm)-u(k,j+offy_u,i+offx_u,icrm))+
                                   (w(kc,j+offy_w,i+offx_w,icrm)*rup-w(k,j+offy_w,i+offx_w,icrm)*rdn) )*dta +
@@ -10,5 +10,7 @@
 extern "C" void fftfax_crm(int n, int *ifax, real *trigs);
 extern "C" void fft991_crm(real *a, real *work, real *trigs, int *ifax, int inc, int jump, int n, int lot, int isign);
 
+void pressure_init();
+
 void pressure();
 
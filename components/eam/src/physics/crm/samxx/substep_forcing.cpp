@@ -0,0 +1,180 @@
+
+#include "substep_forcing.h"
+
+// Pointwise processes at the start of each substep, in the same order as in SAM:
+//   zero the tendencies, buoyancy, large-scale forcing, radiative heating,
+//   and damping near the upper boundary (sponge).
+// These are fused, so that the 3D fields are streamed through memory once.
+// Only the water vapor fixer and the damping need horizontal sums of the
+// updated fields, which are accumulated in the first pass and used in the second.
+void substep_forcing() {
+  YAKL_SCOPE( dudt           , :: dudt );
+  YAKL_SCOPE( dvdt           , :: dvdt );
+  YAKL_SCOPE( dwdt           , :: dwdt );
+  YAKL_SCOPE( misc           , :: misc );
+  YAKL_SCOPE( na             , :: na );
+  YAKL_SCOPE( adz            , :: adz );
+  YAKL_SCOPE( bet            , :: bet );
+  YAKL_SCOPE( tabs0          , :: tabs0 );
+  YAKL_SCOPE( qv             , :: qv );
+  YAKL_SCOPE( qv0            , :: qv0 );
+  YAKL_SCOPE( qcl            , :: qcl );
+  YAKL_SCOPE( qci            , :: qci );
+  YAKL_SCOPE( qn0            , :: qn0 );
+  YAKL_SCOPE( qpl            , :: qpl );
+  YAKL_SCOPE( qpi            , :: qpi );
+  YAKL_SCOPE( qp0            , :: qp0 );
+  YAKL_SCOPE( tabs           , :: tabs );
+  YAKL_SCOPE( t              , :: t );
+  YAKL_SCOPE( ttend          , :: ttend );
+  YAKL_SCOPE( dtn            , :: dtn );
+  YAKL_SCOPE( micro_field    , :: micro_field );
+  YAKL_SCOPE( qtend          , :: qtend );
+  YAKL_SCOPE( utend          , :: utend );
+  YAKL_SCOPE( vtend          , :: vtend );
+  YAKL_SCOPE( crm_rad_qrad   , :: crm_rad_qrad );
+  YAKL_SCOPE( z              , :: z );
+  YAKL_SCOPE( u              , :: u );
+  YAKL_SCOPE( v              , :: v );
+  YAKL_SCOPE( w              , :: w );
+  YAKL_SCOPE( ncrms          , :: ncrms );
+
+  real constexpr tau_min    = 60.0;
+  real constexpr tau_max    = 450.0;
+  real constexpr fractional_damp_depth = 0.4;
+
+  bool do_buoyancy = !docolumn;
+  bool do_damping  = dodamping;
+
+  if (do_damping && tau_min < 2.0*dt) {
+    std::cout << "Error: in damping() tau_min is too small!";
+    exit(-1);
+  }
+
+  real2d qneg ("qneg" ,nzm,ncrms);
+  real2d qpoz ("qpoz" ,nzm,ncrms);
+  int2d  nneg ("nneg" ,nzm,ncrms);
+  int1d  n_damp("n_damp",ncrms);
+  real2d t0loc("t0loc",nzm,ncrms);
+  real2d u0loc("u0loc",nzm,ncrms);
+  real2d v0loc("v0loc",nzm,ncrms);
+  real2d tau  ("tau"  ,nzm,ncrms);
+
+  // for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( ncrms , YAKL_LAMBDA (int icrm) {
+    n_damp(icrm) = 0;
+    for (int k=0; k<nzm; k++) {
+      qpoz(k,icrm) = 0.0;
+      qneg(k,icrm) = 0.0;
+      nneg(k,icrm) = 0;
+      u0loc(k,icrm) = 0.0;
+      v0loc(k,icrm) = 0.0;
+      t0loc(k,icrm) = 0.0;
+      if(z(nzm-1,icrm)-z(k,icrm) < fractional_damp_depth*z(nzm-1,icrm)) {
+        n_damp(icrm) = n_damp(icrm) + 1;
+      }
+    }
+    for (int k=0; k<nzm; k++) {
+      tau(k,icrm) = 0;
+      if ( (k <= nzm-1) && (k >= nzm-1-n_damp(icrm)) ) {
+        tau(k,icrm) = tau_min * pow( (tau_max/tau_min) ,
+                                   ( ( z(nzm-1,icrm) - z(k,icrm) ) / ( z(nzm-1,icrm) - z( nzm-1-n_damp(icrm) , icrm ) ) ) );
+        tau(k,icrm) = 1. / tau(k,icrm);
+      }
+    }
+  });
+
+  // for (int k=0; k<nz; k++) {
+  //   for (int j=0; j<nyp1; j++) {
+  //     for (int i=0; i<nxp1; i++) {
+  //       for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<4>(nz,nyp1,nxp1,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    int idwv = index_water_vapor;
+
+    // zero the tendencies
+    if(i<nxp1 && j<ny && k<nzm){ dudt(na-1,k,j,i,icrm) = 0.0; }
+    if(i<nx && j<nyp1 && k<nzm){ dvdt(na-1,k,j,i,icrm) = 0.0; }
+    if(i<nx && j<ny && k<nz){ dwdt(na-1,k,j,i,icrm) = 0.0; }
+    if(i<nx && j<ny && k<nz){ misc(k,j,i,icrm) = 0.0; }
+
+    if (i >= nx || j >= ny || k >= nzm) { return; }
+
+    // buoyancy, at the interface between levels k-1 and k
+    if (do_buoyancy && k > 0) {
+      int km = k-1;
+      real betu = adz(km,icrm)/(adz(k,icrm)+adz(km,icrm));
+      real betd = adz(k,icrm)/(adz(k,icrm)+adz(km,icrm));
+
+      dwdt(na-1,k,j,i,icrm) =
+            dwdt(na-1,k,j,i,icrm) +
+               bet(k,icrm)*betu*
+               ( tabs0(k,icrm)*(epsv*(qv(k,j,i,icrm)-qv0(k,icrm))-(qcl(k,j,i,icrm)+qci(k,j,i,icrm)-
+                                qn0(k,icrm)+qpl(k,j,i,icrm)+qpi(k,j,i,icrm)-qp0(k,icrm)))
+               +(tabs(k,j,i,icrm)-tabs0(k,icrm))*(1.0+epsv*qv0(k,icrm)-qn0(k,icrm)-qp0(k,icrm)) )
+               +bet(km,icrm)*betd*
+               ( tabs0(km,icrm)*(epsv*(qv(km,j,i,icrm)-qv0(km,icrm))-(qcl(km,j,i,icrm)+qci(km,j,i,icrm)-
+                                 qn0(km,icrm)+qpl(km,j,i,icrm)+qpi(km,j,i,icrm)-qp0(km,icrm)))
+               +(tabs(km,j,i,icrm)-tabs0(km,icrm))*(1.0+epsv*qv0(km,icrm)-qn0(km,icrm)-qp0(km,icrm)) );
+    }
+
+    // large-scale forcing
+    t(k, j+offy_s, i+offx_s, icrm) = t(k, j+offy_s, i+offx_s, icrm) + ttend(k,icrm) * dtn;
+    micro_field(idwv, k, j+offy_s, i+offx_s, icrm) =
+          micro_field(idwv, k, j+offy_s, i+offx_s, icrm) + qtend(k,icrm) * dtn;
+
+    if (micro_field(idwv, k, j+offy_s, i+offx_s, icrm) < 0.0) {
+      yakl::atomicAdd(nneg(k,icrm),1);
+      yakl::atomicAdd(qneg(k,icrm),micro_field(idwv, k, j+offy_s, i+offx_s, icrm));
+    } else {
+      yakl::atomicAdd(qpoz(k,icrm),micro_field(idwv, k, j+offy_s, i+offx_s, icrm));
+    }
+    dudt(na-1,k,j,i,icrm) = dudt(na-1,k,j,i,icrm) + utend(k,icrm);
+    dvdt(na-1,k,j,i,icrm) = dvdt(na-1,k,j,i,icrm) + vtend(k,icrm);
+
+    // radiative heating
+    int i_rad = i / (nx/crm_nx_rad);
+    int j_rad = j / (ny/crm_ny_rad);
+    t(k,j+offy_s,i+offx_s,icrm) = t(k,j+offy_s,i+offx_s,icrm) + crm_rad_qrad(k,j_rad,i_rad,icrm)*dtn;
+
+    // grid-mean u0, v0, t0 for the damping, with the updated t.
+    // No need for qv0, as qv has not been updated yet.
+    if (do_damping) {
+      real tmp;
+
+      tmp = u(k,offy_u+j,offx_u+i,icrm)/( (real) nx * (real) ny );
+      yakl::atomicAdd(u0loc(k,icrm),tmp);
+
+      tmp = v(k,offy_v+j,offx_v+i,icrm)/( (real) nx * (real) ny );
+      yakl::atomicAdd(v0loc(k,icrm),tmp);
+
+      tmp = t(k,offy_s+j,offx_s+i,icrm)/( (real) nx * (real) ny );
+      yakl::atomicAdd(t0loc(k,icrm),tmp);
+    }
+  });
+
+  // for (int k=0; k<nzm; k++) {
+  //   for (int j=0; j<ny; j++) {
+  //     for (int i=0; i<nx; i++) {
+  //       for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    int idwv = index_water_vapor;
+
+    // remove negative water vapor, conserving the column total
+    real factor;
+    if(nneg(k,icrm) > 0 && qpoz(k,icrm)+qneg(k,icrm) > 0.0) {
+      factor =  1.0 + qneg(k,icrm)/qpoz(k,icrm);
+      micro_field(idwv, k, j+offy_s, i+offx_s, icrm) =
+            max(0.0,micro_field(idwv, k, j+offy_s, i+offx_s, icrm)*factor);
+    }
+
+    // suppress turbulence near the upper boundary
+    if ( do_damping && k <= nzm-1 && k >= nzm-1-n_damp(icrm) ) {
+      dudt       (na-1,k,       j,       i,icrm) -=     (u (k,offy_u+j,offx_u+i,icrm)-u0loc(k,icrm)) * tau(k,icrm);
+      dvdt       (na-1,k,       j,       i,icrm) -=     (v (k,offy_v+j,offx_v+i,icrm)-v0loc(k,icrm)) * tau(k,icrm);
+      dwdt       (na-1,k,       j,       i,icrm) -=      w (k,offy_w+j,offx_w+i,icrm)                * tau(k,icrm);
+      t          (     k,offy_s+j,offx_s+i,icrm) -= dtn*(t (k,offy_s+j,offx_s+i,icrm)-t0loc(k,icrm)) * tau(k,icrm);
+      micro_field(idwv,k,offy_s+j,offx_s+i,icrm) -= dtn*(qv(k,       j,       i,icrm)-qv0  (k,icrm)) * tau(k,icrm);
+    }
+  });
+}
+
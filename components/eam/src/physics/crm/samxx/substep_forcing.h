@@ -4,5 +4,5 @@
 #include "samxx_const.h"
 #include "vars.h"
 
-void forcing();
+void substep_forcing();
 
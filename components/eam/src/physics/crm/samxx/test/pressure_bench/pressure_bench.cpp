@@ -0,0 +1,91 @@
+
+// Standalone benchmark of the samxx pressure solver, using the 3D build configuration.
+// It compares the cost of a pressure() call with the persistent scratch (as done in
+// timeloop), against one that also re-allocates and re-initializes it (as pressure()
+// used to do in every substep).
+
+#include "vars.h"
+#include "pressure.h"
+#include <chrono>
+#include <iostream>
+
+int main(int argc, char **argv) {
+  int ntrials = 100;
+  if (argc > 1) { ntrials = atoi(argv[1]); }
+
+  yakl::init();
+  {
+    ncrms = NCRMS;
+    pcols = NCRMS;
+    allocate();
+
+    YAKL_SCOPE( rho           , :: rho );
+    YAKL_SCOPE( rhow          , :: rhow );
+    YAKL_SCOPE( adz           , :: adz );
+    YAKL_SCOPE( adzw          , :: adzw );
+    YAKL_SCOPE( dz            , :: dz );
+    YAKL_SCOPE( dudt          , :: dudt );
+    YAKL_SCOPE( dvdt          , :: dvdt );
+    YAKL_SCOPE( dwdt          , :: dwdt );
+
+    dx = CRM_DX;
+    dy = CRM_DX;
+    dtn = CRM_DT;
+    na = 1; nb = 2; nc = 3;
+    at = 1.0; bt = 0.0; ct = 0.0;
+
+    // A stretched vertical grid and a hydrostatic-like density profile
+    parallel_for( ncrms , YAKL_LAMBDA (int icrm) {
+      dz(icrm) = 100.0;
+      for (int k=0; k<nz; k++) {
+        adzw(k,icrm) = 1.0 + 0.02*k;
+        rhow(k,icrm) = exp(-0.1*k);
+      }
+      for (int k=0; k<nzm; k++) {
+        adz (k,icrm) = 0.5*(adzw(k,icrm)+adzw(k+1,icrm));
+        rho (k,icrm) = 0.5*(rhow(k,icrm)+rhow(k+1,icrm));
+      }
+    });
+
+    // Smooth, non-trivial tendencies, so that the rhs is not zero
+    parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+      real val = sin(0.3*i+0.2*j+0.1*k+0.01*icrm);
+      for (int n=0; n<3; n++) {
+        dudt(n,k,j,i,icrm) = val;
+        dvdt(n,k,j,i,icrm) = YES3D*val;
+        dwdt(n,k,j,i,icrm) = 0.1*val;
+      }
+    });
+
+    // Warm up
+    pressure_init();
+    pressure();
+    yakl::fence();
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (int n=0; n<ntrials; n++) {
+      pressure_init();
+      pressure();
+    }
+    yakl::fence();
+    auto t1 = std::chrono::steady_clock::now();
+    for (int n=0; n<ntrials; n++) {
+      pressure();
+    }
+    yakl::fence();
+    auto t2 = std::chrono::steady_clock::now();
+
+    double t_init  = std::chrono::duration<double,std::micro>(t1-t0).count()/ntrials;
+    double t_reuse = std::chrono::duration<double,std::micro>(t2-t1).count()/ntrials;
+
+    std::cout << "pressure() benchmark: nx=" << nx << " ny=" << ny << " nzm=" << nzm
+              << " ncrms=" << ncrms << " trials=" << ntrials << "\n";
+    std::cout << "  re-initialized scratch: " << t_init  << " us/call\n";
+    std::cout << "  persistent scratch    : " << t_reuse << " us/call\n";
+    std::cout << "  saving per call       : " << t_init-t_reuse << " us ("
+              << 100.0*(t_init-t_reuse)/t_init << "%)\n";
+
+    finalize();
+  }
+  yakl::finalize();
+}
@@ -3,17 +3,15 @@
 
 void timeloop() {
   YAKL_SCOPE( crm_output_subcycle_factor , :: crm_output_subcycle_factor );
-  YAKL_SCOPE( t                        , :: t );
-  YAKL_SCOPE( crm_rad_qrad             , :: crm_rad_qrad );
-  YAKL_SCOPE( dtn                      , :: dtn );
   YAKL_SCOPE( ncrms                    , :: ncrms );
-  YAKL_SCOPE( na                       , :: na );
-  YAKL_SCOPE( dt3                      , :: dt3 );
   YAKL_SCOPE( use_VT                   , :: use_VT );
   YAKL_SCOPE( use_ESMT                 , :: use_ESMT );
 
   nstep = 0;
 
+  // Allocate the pressure solver scratch once, rather than in every substep
+  pressure_init();
+
   do {
     nstep = nstep + 1;
 
@@ -26,9 +24,7 @@ void timeloop() {
     for(int icyc=1; icyc<=ncycle; icyc++) {
       icycle = icyc;
       dtn = dt/ncycle;
-      parallel_for( 1 , YAKL_LAMBDA ( int i ) {
-        dt3(na-1) = dtn;
-      });
+      dt3(na-1) = dtn;
       dtfactor = dtn/dt;
 
       parallel_for( ncrms , YAKL_LAMBDA (int icrm) {
@@ -39,14 +35,6 @@ void timeloop() {
       //    the Adams-Bashforth scheme in time
       abcoefs();
 
-      //---------------------------------------------
-      //    initialize stuff:
-      zero();
-
-      //-----------------------------------------------------------
-      //       Buoyancy term:
-      buoyancy();
-
       //-----------------------------------------------------------
       // variance transport forcing
       if (use_VT) {
@@ -54,26 +42,10 @@ void timeloop() {
         VT_forcing();
       }
 
-      //------------------------------------------------------------
-      //       Large-scale and surface forcing:
-      forcing();
-
-      // Apply radiative tendency
-      // for (int k=0; k<nzm; k++) {
-      //   for (int j=0; j<ny; j++) {
-      //     for (int i=0; i<nx; i++) {
-      //       for (int icrm=0; icrm<ncrms; icrm++) {
-      parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-        int i_rad = i / (nx/crm_nx_rad);
-        int j_rad = j / (ny/crm_ny_rad);
-        t(k,j+offy_s,i+offx_s,icrm) = t(k,j+offy_s,i+offx_s,icrm) + crm_rad_qrad(k,j_rad,i_rad,icrm)*dtn;
-      });
-
-      //----------------------------------------------------------
-      //    suppress turbulence near the upper boundary (spange):
-      if (dodamping) { 
-        damping();
-      }
+      //-----------------------------------------------------------
+      //    initialize stuff, buoyancy term, large-scale and surface forcing,
+      //    radiative tendency, and suppress turbulence near the upper boundary (sponge):
+      substep_forcing();
 
       //---------------------------------------------------------
       //   Ice fall-out
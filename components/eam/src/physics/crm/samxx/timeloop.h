@@ -5,10 +5,7 @@
 #include "vars.h"
 #include "kurant.h"
 #include "abcoefs.h"
-#include "zero.h"
-#include "buoyancy.h"
-#include "forcing.h"
-#include "damping.h"
+#include "substep_forcing.h"
 #include "ice_fall.h"
 #include "boundaries.h"
 #include "crmsurface.h"
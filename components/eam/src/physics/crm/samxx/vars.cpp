@@ -86,7 +86,7 @@ void allocate() {
   adz              = real2d( "adz             "                        , nzm    , ncrms ); 
   adzw             = real2d( "adzw            "                        , nz     , ncrms ); 
   dz               = real1d( "dz              "                                 , ncrms ); 
-  dt3              = real1d( "dt3             " , 3                                     ); 
+  dt3              = realHost1d( "dt3             " , 3                                 ); 
   u                = real4d( "u               "     , nzm , dimy_u     , dimx_u , ncrms ); 
   v                = real4d( "v               "     , nzm , dimy_v     , dimx_v , ncrms ); 
   w                = real4d( "w               "     , nz  , dimy_w     , dimx_w , ncrms ); 
@@ -267,7 +267,7 @@ void allocate() {
   yakl::memset(adz               ,0.);
   yakl::memset(adzw              ,0.);
   yakl::memset(dz                ,0.);
-  yakl::memset(dt3               ,0.);
+  for (int i=0; i<3; i++) { dt3(i) = 0.; }
   yakl::memset(u                 ,0.);
   yakl::memset(v                 ,0.);
   yakl::memset(w                 ,0.);
@@ -551,7 +551,7 @@ void finalize() {
   adz              = real2d(); 
   adzw             = real2d(); 
   dz               = real1d(); 
-  dt3              = real1d(); 
+  dt3              = realHost1d(); 
   u                = real4d();
   v                = real4d();
   w                = real4d();
@@ -669,6 +669,21 @@ void finalize() {
 
   yakl::fence();
 
+  pressure_f       = real4d();
+  pressure_a       = real2d();
+  pressure_c       = real2d();
+  pressure_eign    = real2d();
+#ifdef USE_ORIG_FFT
+  pressure_work    = realHost2d();
+  pressure_ftmp_x  = realHost1d();
+  pressure_ftmp_y  = realHost1d();
+  pressure_trigxi  = realHost1d();
+  pressure_trigxj  = realHost1d();
+  pressure_ifaxi   = intHost1d();
+  pressure_ifaxj   = intHost1d();
+  pressure_fHost   = realHost4d();
+#endif
+
   pressure_fftx.cleanup();
   pressure_ffty.cleanup();
   vt_fftx.cleanup();
@@ -1489,7 +1504,6 @@ void perturb_arrays() {
     perturb( adz               , mag );
     perturb( adzw              , mag );
     perturb( dz                , mag );
-    perturb( dt3               , mag );
     perturb( sgs_field         , mag );
     perturb( sgs_field_diag    , mag );
     perturb( grdf_x            , mag );
@@ -1643,7 +1657,7 @@ real2d zi              ;
 real2d presi           ;
 real2d adz             ;
 real2d adzw            ;
-real1d dt3             ;
+realHost1d dt3         ;
 real1d dz              ;
 
 real5d sgs_field       ;
@@ -1975,6 +1989,21 @@ int igstep;
 
 yakl::RealFFT1D<real> pressure_fftx;
 yakl::RealFFT1D<real> pressure_ffty;
+
+real4d pressure_f;
+real2d pressure_a;
+real2d pressure_c;
+real2d pressure_eign;
+#ifdef USE_ORIG_FFT
+realHost2d pressure_work;
+realHost1d pressure_ftmp_x;
+realHost1d pressure_ftmp_y;
+realHost1d pressure_trigxi;
+realHost1d pressure_trigxj;
+intHost1d  pressure_ifaxi;
+intHost1d  pressure_ifaxj;
+realHost4d pressure_fHost;
+#endif
 yakl::RealFFT1D<real> vt_fftx;
 yakl::RealFFT1D<real> vt_ffty;
 yakl::RealFFT1D<real> esmt_fftx;
@@ -353,7 +353,7 @@ extern real2d zi              ;
 extern real2d presi           ;
 extern real2d adz             ;
 extern real2d adzw            ;
-extern real1d dt3             ;
+extern realHost1d dt3         ;
 extern real1d dz              ;
 
 extern real2d grdf_x          ;
@@ -554,6 +554,22 @@ extern int igstep;
 
 extern yakl::RealFFT1D<real> pressure_fftx;
 extern yakl::RealFFT1D<real> pressure_ffty;
+
+// Pressure solver scratch, allocated by pressure_init() and reused by every pressure() call
+extern real4d pressure_f;
+extern real2d pressure_a;
+extern real2d pressure_c;
+extern real2d pressure_eign;
+#ifdef USE_ORIG_FFT
+extern realHost2d pressure_work;
+extern realHost1d pressure_ftmp_x;
+extern realHost1d pressure_ftmp_y;
+extern realHost1d pressure_trigxi;
+extern realHost1d pressure_trigxj;
+extern intHost1d  pressure_ifaxi;
+extern intHost1d  pressure_ifaxj;
+extern realHost4d pressure_fHost;
+#endif
 extern yakl::RealFFT1D<real> vt_fftx;
 extern yakl::RealFFT1D<real> vt_ffty;
 extern yakl::RealFFT1D<real> esmt_fftx;
@@ -25,6 +25,9 @@ void SurfaceCouplingExporter::set_grids(const std::shared_ptr<const GridsManager
   m_num_cols = m_grid->get_num_local_dofs();       // Number of columns on this rank
   m_num_levs = m_grid->get_num_vertical_levels();  // Number of levels per column
 
+  // If true, exports that cannot change between steps are only transferred once
+  m_skip_invariant_transfers = m_params.get<bool>("skip_invariant_transfers",false);
+
   const auto m2 = m*m;
   const auto s2 = s*s;
   auto Wm2 = W/m2;
@@ -142,7 +145,13 @@ void SurfaceCouplingExporter::setup_surface_coupling_data(const SCDataManager &s
   // The export data is of size ncols,num_cpl_exports. All other data is of size num_scream_exports
   m_cpl_exports_view_h = decltype(m_cpl_exports_view_h) (sc_data_manager.get_field_data_ptr(),
                                                          m_num_cols, m_num_cpl_exports);
-  m_cpl_exports_view_d = Kokkos::create_mirror_view(DefaultDevice(), m_cpl_exports_view_h);
+  if (surface_coupling_needs_staging()) {
+    m_staging_view_d = decltype(m_staging_view_d) ("cpl_exports_staging",m_num_cols,m_num_scream_exports);
+    m_staging_view_h = decltype(m_staging_view_h) ("cpl_exports_staging_h",m_num_cols,m_num_scream_exports);
+  } else {
+    m_staging_view_d = decltype(m_staging_view_d) (sc_data_manager.get_field_data_ptr(),
+                                                   m_num_cols, m_num_cpl_exports);
+  }
 
   m_export_field_names = new name_t[m_num_scream_exports];
   std::memcpy(m_export_field_names, sc_data_manager.get_field_name_ptr(), m_num_scream_exports*32*sizeof(char));
@@ -270,7 +279,7 @@ void SurfaceCouplingExporter::initialize_impl (const RunType /* run_type */)
         m_time_interp.add_field(f_helper.alias(rname), true);
         m_export_from_file_field_names.push_back(fname);
       }
-      m_time_interp.initialize_data_from_files();
+      m_time_interp.initialize_data_from_files(timestamp());
     }
   }
 
@@ -306,10 +315,55 @@ void SurfaceCouplingExporter::initialize_impl (const RunType /* run_type */)
   EKAT_REQUIRE_MSG(m_num_scream_exports = m_num_from_file_exports+m_num_const_exports+m_num_from_model_exports,"Error! surface_coupling_exporter - Something went wrong set the type of export for all variables.");
   EKAT_REQUIRE_MSG(m_num_from_model_exports>=0,"Error! surface_coupling_exporter - The number of exports derived from EAMxx < 0, something must have gone wrong in assigning the types of exports for all variables.");
 
+  setup_transfer_lists();
+
   // Perform initial export (if any are marked for export during initialization)
   if (any_initial_exports) do_export(0, true);
 }
 // =========================================================================================
+void SurfaceCouplingExporter::setup_transfer_lists ()
+{
+  using Stage = SurfaceCouplingTransferStage;
+  std::vector<int> ids[num_surface_coupling_transfer_stages];
+  for (int i=0; i<m_num_scream_exports; ++i) {
+    const auto& info = m_column_info_h(i);
+    const bool invariant = m_skip_invariant_transfers &&
+                           (m_export_source_h(i)==CONSTANT || info.constant_multiple==0);
+
+    if (info.transfer_during_initialization) {
+      ids[etoi(Stage::Initialization)].push_back(i);
+    }
+    ids[etoi(Stage::FirstRun)].push_back(i);
+    if (not invariant) {
+      ids[etoi(Stage::Run)].push_back(i);
+    }
+  }
+
+  for (int stage=0; stage<num_surface_coupling_transfer_stages; ++stage) {
+    const int n = ids[stage].size();
+    m_transfer_ids_d[stage] = view_1d<DefaultDevice,int>("export_transfer_ids",n);
+    m_transfer_ids_h[stage] = Kokkos::create_mirror_view(m_transfer_ids_d[stage]);
+    std::vector<bool> exported(m_num_cpl_exports,false);
+    for (int j=0; j<n; ++j) {
+      m_transfer_ids_h[stage](j) = ids[stage][j];
+      exported[m_column_info_h(ids[stage][j]).cpl_indx] = true;
+    }
+    Kokkos::deep_copy(m_transfer_ids_d[stage],m_transfer_ids_h[stage]);
+
+    // Any field not exported by scream, or not exported during initialization,
+    // is set to 0.0. If we skip invariant transfers, this was already done
+    // at the first export of the run, and nothing else writes in the cpl data.
+    if (stage==etoi(Stage::Run) && m_skip_invariant_transfers) {
+      continue;
+    }
+    for (int icpl=0; icpl<m_num_cpl_exports; ++icpl) {
+      if (not exported[icpl]) {
+        m_cpl_zero_ids[stage].push_back(icpl);
+      }
+    }
+  }
+}
+// =========================================================================================
 void SurfaceCouplingExporter::run_impl (const double dt)
 {
   do_export(dt);
@@ -540,30 +594,65 @@ void SurfaceCouplingExporter::compute_eamxx_exports(const double dt, const bool
 void SurfaceCouplingExporter::do_export_to_cpl(const bool called_during_initialization)
 {
   using policy_type = KT::RangePolicy;
-  // Any field not exported by scream, or not exported
-  // during initialization, is set to 0.0
-  Kokkos::deep_copy(m_cpl_exports_view_d, 0.0);
-  const auto cpl_exports_view_d = m_cpl_exports_view_d;
-  const int  num_exports        = m_num_scream_exports;
+  using host_policy_type = KokkosTypes<HostDevice>::RangePolicy;
+
+  using Stage = SurfaceCouplingTransferStage;
+  const int stage = etoi(called_during_initialization ? Stage::Initialization
+                         : (m_first_run_export ? Stage::FirstRun : Stage::Run));
+  if (not called_during_initialization) {
+    m_first_run_export = false;
+  }
+
+  const auto staging_view_d     = m_staging_view_d;
+  const auto transfer_ids_d     = m_transfer_ids_d[stage];
+  const int  num_transfers      = transfer_ids_d.extent(0);
   const int  num_cols           = m_num_cols;
   const auto col_info           = m_column_info_d;
-  // Export to cpl data
-  auto export_policy   = policy_type (0,num_exports*num_cols);
+  constexpr bool use_staging    = surface_coupling_needs_staging();
+
+  // Export to cpl data (or to the staging buffer)
+  auto export_policy   = policy_type (0,num_transfers*num_cols);
   Kokkos::parallel_for(export_policy, KOKKOS_LAMBDA(const int& i) {
-    const int ifield = i / num_cols;
-    const int icol   = i % num_cols;
-    const auto& info = col_info(ifield);
+    const int j    = i / num_cols;
+    const int icol = i % num_cols;
+    const auto& info = col_info(transfer_ids_d(j));
     const auto offset = icol*info.col_stride + info.col_offset;
+    const int scol = use_staging ? j : info.cpl_indx;
 
-    // if this is during initialization, check whether or not the field should be exported
-    bool do_export = (not called_during_initialization || info.transfer_during_initialization);
-    if (do_export) {
-      cpl_exports_view_d(icol,info.cpl_indx) = info.constant_multiple*info.data[offset];
-    }
+    staging_view_d(icol,scol) = info.constant_multiple*info.data[offset];
   });
 
-  // Deep copy fields from device to cpl host array
-  Kokkos::deep_copy(m_cpl_exports_view_h,m_cpl_exports_view_d);
+  const auto cpl_exports_view_h = m_cpl_exports_view_h;
+  const auto& zero_ids          = m_cpl_zero_ids[stage];
+  const int  num_zeros          = zero_ids.size();
+  if (use_staging && num_transfers>0) {
+    // Single copy of the staging buffer to host, then scatter in the cpl data
+    const auto staging_view_h = m_staging_view_h;
+    const auto staging_sub_d = Kokkos::subview(staging_view_d,Kokkos::ALL,std::make_pair(0,num_transfers));
+    const auto staging_sub_h = Kokkos::subview(staging_view_h,Kokkos::ALL,std::make_pair(0,num_transfers));
+    Kokkos::deep_copy(staging_sub_h,staging_sub_d);
+
+    const auto transfer_ids_h = m_transfer_ids_h[stage];
+    const auto col_info_h     = m_column_info_h;
+    Kokkos::parallel_for(host_policy_type(0,num_cols), [&](const int& icol) {
+      for (int j=0; j<num_transfers; ++j) {
+        cpl_exports_view_h(icol,col_info_h(transfer_ids_h(j)).cpl_indx) = staging_view_h(icol,j);
+      }
+    });
+  } else if (num_transfers>0) {
+    // The kernel wrote directly in the cpl data, but we need to be done
+    // before the cpl can read it.
+    Kokkos::fence();
+  }
+
+  // Any field not exported (at this stage) is set to 0.0
+  if (num_zeros>0) {
+    Kokkos::parallel_for(host_policy_type(0,num_cols), [&](const int& icol) {
+      for (int k=0; k<num_zeros; ++k) {
+        cpl_exports_view_h(icol,zero_ids[k]) = 0;
+      }
+    });
+  }
 }
 // =========================================================================================
 void SurfaceCouplingExporter::finalize_impl()
@@ -93,6 +93,9 @@ protected:
   void run_impl        (const double dt);
   void finalize_impl   ();
 
+  // Build the lists of exports to transfer at each SurfaceCouplingTransferStage
+  void setup_transfer_lists ();
+
   // Creates an helper field, not to be shared with the AD's FieldManager
   void create_helper_field (const std::string& name,
                             const FieldLayout& layout,
@@ -135,12 +138,27 @@ protected:
   util::TimeInterpolation           m_time_interp;
   std::vector<std::string>          m_export_from_file_field_names;
 
-  // Views storing a 2d array with dims (num_cols,num_fields) for cpl export data.
+  // View storing a 2d array with dims (num_cols,num_fields) for cpl export data.
   // The field idx strides faster, since that's what mct does (so we can "view" the
   // pointer to the whole a2x array from Fortran)
-  view_2d <DefaultDevice, Real> m_cpl_exports_view_d;
   uview_2d<HostDevice,    Real> m_cpl_exports_view_h;
 
+  // Staging buffers with dims (num_cols,num_scream_exports), holding only the
+  // cpl columns that are actually exported. The device view is filled by a single
+  // kernel, and copied to host with a single deep copy. If the device can access
+  // host memory, no staging is needed, and m_staging_view_d is simply an
+  // (unmanaged) view of the whole cpl data.
+  view_2d<DefaultDevice, Real>                                   m_staging_view_d;
+  Kokkos::View<Real**,Kokkos::LayoutRight,SurfaceCouplingPinnedSpace> m_staging_view_h;
+
+  // For each transfer stage, the list of scream exports to transfer, and the
+  // list of cpl fields that must be zeroed (since they are not exported)
+  view_1d<DefaultDevice, int>                    m_transfer_ids_d[num_surface_coupling_transfer_stages];
+  view_1d<DefaultDevice, int>::HostMirror        m_transfer_ids_h[num_surface_coupling_transfer_stages];
+  std::vector<int>                               m_cpl_zero_ids[num_surface_coupling_transfer_stages];
+  bool m_skip_invariant_transfers;
+  bool m_first_run_export = true;
+
   // Array storing the field names for exports
   name_t*                   m_export_field_names;
   std::vector<std::string>  m_export_field_names_vector;
@@ -26,6 +26,9 @@ void SurfaceCouplingImporter::set_grids(const std::shared_ptr<const GridsManager
 
   m_num_cols = m_grid->get_num_local_dofs();      // Number of columns on this rank
 
+  // If true, imports that cannot change between steps are only transferred once
+  m_skip_invariant_transfers = m_params.get<bool>("skip_invariant_transfers",false);
+
   // The units of mixing ratio Q are technically non-dimensional.
   // Nevertheless, for output reasons, we like to see 'kg/kg'.
   auto Qunit = kg/kg;
@@ -71,8 +74,13 @@ void SurfaceCouplingImporter::set_grids(const std::shared_ptr<const GridsManager
   // The import data is of size ncols,num_cpl_imports. All other data is of size num_scream_imports
   m_cpl_imports_view_h = decltype(m_cpl_imports_view_h) (sc_data_manager.get_field_data_ptr(),
                                                          m_num_cols, m_num_cpl_imports);
-  m_cpl_imports_view_d = Kokkos::create_mirror_view_and_copy(DefaultDevice(),
-                                                             m_cpl_imports_view_h);
+  if (surface_coupling_needs_staging()) {
+    m_staging_view_d = decltype(m_staging_view_d) ("cpl_imports_staging",m_num_cols,m_num_scream_imports);
+    m_staging_view_h = decltype(m_staging_view_h) ("cpl_imports_staging_h",m_num_cols,m_num_scream_imports);
+  } else {
+    m_staging_view_d = decltype(m_staging_view_d) (sc_data_manager.get_field_data_ptr(),
+                                                   m_num_cols, m_num_cpl_imports);
+  }
   m_import_field_names = new name_t[m_num_scream_imports];
   std::memcpy(m_import_field_names, sc_data_manager.get_field_name_ptr(), m_num_scream_imports*32*sizeof(char));
 
@@ -125,6 +133,8 @@ void SurfaceCouplingImporter::initialize_impl (const RunType /* run_type */)
   // Copy data to device for use in do_import()
   Kokkos::deep_copy(m_column_info_d, m_column_info_h);
 
+  setup_transfer_lists();
+
   // Set property checks for fields in this proces
   add_postcondition_check<FieldWithinIntervalCheck>(get_field_out("sfc_alb_dir_vis"),m_grid,0.0,1.0,true);
   add_postcondition_check<FieldWithinIntervalCheck>(get_field_out("sfc_alb_dir_nir"),m_grid,0.0,1.0,true);
@@ -135,6 +145,35 @@ void SurfaceCouplingImporter::initialize_impl (const RunType /* run_type */)
   if (any_initial_imports) do_import(true);
 }
 // =========================================================================================
+void SurfaceCouplingImporter::setup_transfer_lists ()
+{
+  using Stage = SurfaceCouplingTransferStage;
+  std::vector<int> ids[num_surface_coupling_transfer_stages];
+  for (int i=0; i<m_num_scream_imports; ++i) {
+    const auto& info = m_column_info_h(i);
+    // An import scaled by 0 is always 0, no matter what the cpl sends
+    const bool invariant = m_skip_invariant_transfers && info.constant_multiple==0;
+
+    if (info.transfer_during_initialization) {
+      ids[etoi(Stage::Initialization)].push_back(i);
+    }
+    ids[etoi(Stage::FirstRun)].push_back(i);
+    if (not invariant) {
+      ids[etoi(Stage::Run)].push_back(i);
+    }
+  }
+
+  for (int stage=0; stage<num_surface_coupling_transfer_stages; ++stage) {
+    const int n = ids[stage].size();
+    m_transfer_ids_d[stage] = view_1d<DefaultDevice,int>("import_transfer_ids",n);
+    m_transfer_ids_h[stage] = Kokkos::create_mirror_view(m_transfer_ids_d[stage]);
+    for (int j=0; j<n; ++j) {
+      m_transfer_ids_h[stage](j) = ids[stage][j];
+    }
+    Kokkos::deep_copy(m_transfer_ids_d[stage],m_transfer_ids_h[stage]);
+  }
+}
+// =========================================================================================
 void SurfaceCouplingImporter::run_impl (const double /* dt */)
 {
   do_import();
@@ -143,31 +182,52 @@ void SurfaceCouplingImporter::run_impl (const double /* dt */)
 void SurfaceCouplingImporter::do_import(const bool called_during_initialization)
 {
   using policy_type = KokkosTypes<DefaultDevice>::RangePolicy;
+  using host_policy_type = KokkosTypes<HostDevice>::RangePolicy;
 
-  // Local copies, to deal with CUDA's handling of *this
-  const auto col_info           = m_column_info_d;
-  const auto cpl_imports_view_d = m_cpl_imports_view_d;
-  const int  num_cols           = m_num_cols;
-  const int  num_imports        = m_num_scream_imports;
+  using Stage = SurfaceCouplingTransferStage;
+  const int stage = etoi(called_during_initialization ? Stage::Initialization
+                         : (m_first_run_import ? Stage::FirstRun : Stage::Run));
+  if (not called_during_initialization) {
+    m_first_run_import = false;
+  }
 
-  // Deep copy cpl host array to devic
-  Kokkos::deep_copy(m_cpl_imports_view_d,m_cpl_imports_view_h);
+  // Local copies, to deal with CUDA's handling of *this
+  const auto col_info        = m_column_info_d;
+  const auto staging_view_d  = m_staging_view_d;
+  const auto transfer_ids_d  = m_transfer_ids_d[stage];
+  const int  num_cols        = m_num_cols;
+  const int  num_transfers   = transfer_ids_d.extent(0);
+  constexpr bool use_staging = surface_coupling_needs_staging();
+
+  if (use_staging && num_transfers>0) {
+    // Gather the imported cpl columns in the pinned staging buffer,
+    // and move them to device with a single deep copy.
+    const auto cpl_imports_view_h = m_cpl_imports_view_h;
+    const auto staging_view_h     = m_staging_view_h;
+    const auto transfer_ids_h     = m_transfer_ids_h[stage];
+    const auto col_info_h         = m_column_info_h;
+    Kokkos::parallel_for(host_policy_type(0,num_cols), [&](const int& icol) {
+      for (int j=0; j<num_transfers; ++j) {
+        staging_view_h(icol,j) = cpl_imports_view_h(icol,col_info_h(transfer_ids_h(j)).cpl_indx);
+      }
+    });
+    const auto staging_sub_d = Kokkos::subview(staging_view_d,Kokkos::ALL,std::make_pair(0,num_transfers));
+    const auto staging_sub_h = Kokkos::subview(staging_view_h,Kokkos::ALL,std::make_pair(0,num_transfers));
+    Kokkos::deep_copy(staging_sub_d,staging_sub_h);
+  }
 
   // Unpack the fields
-  auto unpack_policy = policy_type(0,num_imports*num_cols);
+  auto unpack_policy = policy_type(0,num_transfers*num_cols);
   Kokkos::parallel_for(unpack_policy, KOKKOS_LAMBDA(const int& i) {
-    const int ifield = i / num_cols;
-    const int icol   = i % num_cols;
+    const int j    = i / num_cols;
+    const int icol = i % num_cols;
 
-    const auto& info = col_info(ifield);
+    const auto& info = col_info(transfer_ids_d(j));
 
     auto offset = icol*info.col_stride + info.col_offset;
+    const int scol = use_staging ? j : info.cpl_indx;
 
-    // if this is during initialization, check whether or not the field should be imported
-    bool do_import = (not called_during_initialization || info.transfer_during_initialization);
-    if (do_import) {
-      info.data[offset] = cpl_imports_view_d(icol,info.cpl_indx)*info.constant_multiple;
-    }
+    info.data[offset] = staging_view_d(icol,scol)*info.constant_multiple;
   });
 
   // If IOP is defined, potentially overwrite imports with data from IOP file
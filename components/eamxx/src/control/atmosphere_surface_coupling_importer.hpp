@@ -74,6 +74,9 @@ protected:
   void run_impl        (const double dt);
   void finalize_impl   ();
 
+  // Build the lists of imports to transfer at each SurfaceCouplingTransferStage
+  void setup_transfer_lists ();
+
   // Keep track of field dimensions
   Int m_num_cols;
 
@@ -83,12 +86,25 @@ protected:
   // Number of imports to SCREAM
   Int m_num_scream_imports;
 
-  // Views storing a 2d array with dims (num_cols,num_fields) for import data.
+  // View storing a 2d array with dims (num_cols,num_fields) for import data.
   // The field idx strides faster, since that's what mct does (so we can "view" the
   // pointer to the whole x2a array from Fortran)
-  view_2d <DefaultDevice, Real> m_cpl_imports_view_d;
   uview_2d<HostDevice,    Real> m_cpl_imports_view_h;
 
+  // Staging buffers with dims (num_cols,num_scream_imports), holding only the
+  // cpl columns that are actually imported. The host view is filled from the cpl
+  // data, and then copied to device with a single deep copy. If the device can
+  // access host memory, no staging is needed, and m_staging_view_d is simply an
+  // (unmanaged) view of the whole cpl data.
+  view_2d<DefaultDevice, Real>                                   m_staging_view_d;
+  Kokkos::View<Real**,Kokkos::LayoutRight,SurfaceCouplingPinnedSpace> m_staging_view_h;
+
+  // For each transfer stage, the list of scream imports to transfer
+  view_1d<DefaultDevice, int>                    m_transfer_ids_d[num_surface_coupling_transfer_stages];
+  view_1d<DefaultDevice, int>::HostMirror        m_transfer_ids_h[num_surface_coupling_transfer_stages];
+  bool m_skip_invariant_transfers;
+  bool m_first_run_import = true;
+
   // Array storing the field names for imports
   name_t* m_import_field_names;
 
@@ -2,6 +2,7 @@
 
 #include "share/grid/point_grid.hpp"
 #include "share/io/scorpio_input.hpp"
+#include "share/util/scream_timing.hpp"
 #include "share/util/scream_vertical_interpolation.hpp"
 
 #include "ekat/ekat_assert.hpp"
@@ -9,6 +10,7 @@
 
 #include "pio.h"
 
+#include <algorithm>
 #include <numeric>
 
 // Extend ekat mpi type for <Real,int> pairs,
@@ -411,6 +413,8 @@ read_fields_from_file_for_iop (const std::string& file_name,
     return;
   }
 
+  start_timer("EAMxx::IOP::read_fields_from_file");
+
   const auto& grid_name = field_mgr->get_grid()->name();
   EKAT_REQUIRE_MSG(m_io_grids.count(grid_name) > 0,
                    "Error! Attempting to read IOP initial conditions on "
@@ -459,36 +463,50 @@ read_fields_from_file_for_iop (const std::string& file_name,
   file_reader.read_variables();
   file_reader.finalize();
 
-  // For each field, broadcast data from closest lat/lon column to all processors
-  // and copy data into each field's column in the field manager.
-  for (size_t i=0; i<io_fields.size(); ++i) {
-    const auto& io_field = io_fields[i];
-    const auto& fname = field_names_eamxx[i];
-    auto& fm_field = field_mgr->get_field(fname);
-
+  // Pack the data of the closest lat/lon column of every field into a single
+  // buffer, so that one broadcast from the rank owning the column serves all
+  // fields. col_offsets[i] is the start of field i's data in the buffer.
+  const auto& lat_lon_info = m_lat_lon_info[grid_name];
+  const auto mpi_rank_with_col = lat_lon_info.mpi_rank_of_closest_column;
+  const auto nfields = io_fields.size();
+  std::vector<Field> col_data(nfields);
+  std::vector<int> col_offsets(nfields+1, 0);
+  for (size_t i=0; i<nfields; ++i) {
     // Create a temporary field to store the data from the
     // single column of the closest lat/lon pair
-    const auto io_fid = io_field.get_header().get_identifier();
+    const auto io_fid = io_fields[i].get_header().get_identifier();
     FieldLayout col_data_fl = io_fid.get_layout().strip_dim(0);
     FieldIdentifier col_data_fid("col_data", col_data_fl, dummy_units, "");
-    Field col_data(col_data_fid);
-    col_data.allocate_view();
-
-    // MPI rank with closest column index store column data
-    const auto mpi_rank_with_col = m_lat_lon_info[grid_name].mpi_rank_of_closest_column;
-    if (m_comm.rank() == mpi_rank_with_col) {
-      const auto col_idx_with_data = m_lat_lon_info[grid_name].local_column_index_of_closest_column;
-      col_data.deep_copy<Host>(io_field.subfield(0,col_idx_with_data));
+    col_data[i] = Field(col_data_fid);
+    col_data[i].allocate_view();
+    col_offsets[i+1] = col_offsets[i] + col_data_fl.size();
+  }
+  std::vector<Real> col_buffer(col_offsets[nfields]);
+
+  // MPI rank with closest column index stores column data
+  if (m_comm.rank() == mpi_rank_with_col) {
+    const auto col_idx_with_data = lat_lon_info.local_column_index_of_closest_column;
+    for (size_t i=0; i<nfields; ++i) {
+      col_data[i].deep_copy<Host>(io_fields[i].subfield(0,col_idx_with_data));
+      const auto data = col_data[i].get_internal_view_data<Real,Host>();
+      std::copy(data, data+col_offsets[i+1]-col_offsets[i], col_buffer.data()+col_offsets[i]);
     }
+  }
 
-    // Broadcast column data to all other ranks
-    const auto col_size = col_data.get_header().get_identifier().get_layout().size();
-    m_comm.broadcast(col_data.get_internal_view_data<Real,Host>(), col_size, mpi_rank_with_col);
+  // Broadcast column data of all fields to all other ranks
+  m_comm.broadcast(col_buffer.data(), col_buffer.size(), mpi_rank_with_col);
+
+  // Copy column data to all columns in field manager fields
+  for (size_t i=0; i<nfields; ++i) {
+    const auto& fname = field_names_eamxx[i];
+    auto& fm_field = field_mgr->get_field(fname);
+
+    const auto data = col_data[i].get_internal_view_data<Real,Host>();
+    std::copy(col_buffer.data()+col_offsets[i], col_buffer.data()+col_offsets[i+1], data);
 
-    // Copy column data to all columns in field manager field
     const auto ncols = fm_field.get_header().get_identifier().get_layout().dim(0);
     for (auto icol=0; icol<ncols; ++icol) {
-      fm_field.subfield(0,icol).deep_copy<Host>(col_data);
+      fm_field.subfield(0,icol).deep_copy<Host>(col_data[i]);
     }
 
     // Sync fields to device
@@ -497,6 +515,8 @@ read_fields_from_file_for_iop (const std::string& file_name,
     // Set the initial time stamp on FM fields
     fm_field.get_header().get_tracking().update_time_stamp(initial_ts);
   }
+
+  stop_timer("EAMxx::IOP::read_fields_from_file");
 }
 
 void IntensiveObservationPeriod::
@@ -513,6 +533,8 @@ read_iop_file_data (const util::TimeStamp& current_ts)
   // there is no need to reload data. Return early
   if (iop_file_time_idx == m_time_info.time_idx_of_current_data) return;
 
+  start_timer("EAMxx::IOP::read_iop_file_data");
+
   const auto file_levs = scorpio::get_dimlen(iop_file, "lev");
   const auto iop_file_pressure = m_helper_fields["iop_file_pressure"];
   const auto model_pressure = m_helper_fields["model_pressure"];
@@ -703,6 +725,8 @@ read_iop_file_data (const util::TimeStamp& current_ts)
 
   // Now that data is loaded, reset the index of the currently loaded data.
   m_time_info.time_idx_of_current_data = iop_file_time_idx;
+
+  stop_timer("EAMxx::IOP::read_iop_file_data");
 }
 
 void IntensiveObservationPeriod::
@@ -3,6 +3,9 @@
 
 #include "share/scream_types.hpp"
 #include "share/field/field.hpp"
+#include "share/util/scream_utils.hpp"
+
+#include <type_traits>
 
 namespace scream {
 
@@ -12,6 +15,37 @@ enum class SurfaceCouplingTransferType {
   Export
 };
 
+// Memory space of the host side of the import/export staging buffers.
+// On GPU builds we use page-locked memory, so that the single host<->device
+// copy done at each import/export can run asynchronously and at full bandwidth.
+#if defined(KOKKOS_ENABLE_CUDA)
+using SurfaceCouplingPinnedSpace = Kokkos::CudaHostPinnedSpace;
+#elif defined(KOKKOS_ENABLE_HIP)
+using SurfaceCouplingPinnedSpace = Kokkos::Experimental::HIPHostPinnedSpace;
+#elif defined(KOKKOS_ENABLE_SYCL)
+using SurfaceCouplingPinnedSpace = Kokkos::Experimental::SYCLHostUSMSpace;
+#else
+using SurfaceCouplingPinnedSpace = Kokkos::HostSpace;
+#endif
+
+// Whether the import/export needs a staging buffer, that is, whether the
+// cpl data (which lives on host) is not directly accessible on device.
+constexpr bool surface_coupling_needs_staging () {
+  return not std::is_same<DefaultDevice::memory_space,HostDevice::memory_space>::value;
+}
+
+// When is an import/export happening. Transfers done during initialization
+// only involve fields marked with transfer_during_initialization. If invariant
+// transfers are skipped, fields whose value cannot change between steps (e.g.,
+// constant_multiple=0, or exports set to a constant) are only transferred
+// the first time, and left untouched in the cpl data afterwards.
+enum class SurfaceCouplingTransferStage {
+  Initialization,
+  FirstRun,
+  Run
+};
+constexpr int num_surface_coupling_transfer_stages = 3;
+
 // A device-friendly helper struct, storing column information about the import/export.
 struct SurfaceCouplingColumnInfo {
   // Set to invalid, for ease of checking
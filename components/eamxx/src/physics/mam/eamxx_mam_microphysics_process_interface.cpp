@@ -300,7 +300,7 @@ void MAMMicrophysics::run_impl(const double dt) {
 
   // preprocess input -- needs a scan for the calculation of atm height
   Kokkos::parallel_for("preprocess", scan_policy, preprocess_);
-  Kokkos::fence();
+  debug_fence();
 
   // Reset internal WSM variables.
   //workspace_mgr_.reset_internals();
@@ -386,7 +386,7 @@ void MAMMicrophysics::run_impl(const double dt) {
 
   // postprocess output
   Kokkos::parallel_for("postprocess", policy, postprocess_);
-  Kokkos::fence();
+  debug_fence();
 }
 
 void MAMMicrophysics::finalize_impl()
@@ -11,6 +11,7 @@ Nudging::Nudging (const ekat::Comm& comm, const ekat::ParameterList& params)
   : AtmosphereProcess(comm, params)
 {
   m_datafiles  = m_params.get<std::vector<std::string>>("nudging_filename");
+  m_time_index_file = m_params.get<std::string>("nudging_time_index_file","");
   m_timescale = m_params.get<int>("nudging_timescale",0);
   m_fields_nudge = m_params.get<std::vector<std::string>>("nudging_fields");
   m_use_weights   = m_params.get<bool>("use_nudging_weights",false);
@@ -272,7 +273,7 @@ void Nudging::initialize_impl (const RunType /* run_type */)
   FieldLayout scalar3d_layout_mid_ext { {COL,LEV}, {m_num_cols_ext, m_num_src_levs} };
 
   // Initialize the time interpolator
-  m_time_interp = util::TimeInterpolation(grid_ext, m_datafiles);
+  m_time_interp = util::TimeInterpolation(grid_ext, m_datafiles, m_time_index_file);
 
   constexpr int ps = SCREAM_PACK_SIZE;
   // To be extra careful, this should be the ext_grid
@@ -327,7 +328,7 @@ void Nudging::initialize_impl (const RunType /* run_type */)
     // Add the fields to the time interpolator
     m_time_interp.add_field(field_ext.alias(name), true);
   }
-  m_time_interp.initialize_data_from_files();
+  m_time_interp.initialize_data_from_files(timestamp());
 
   // Close the registration!
   m_refine_remapper->registration_ends();
@@ -128,6 +128,7 @@ protected:
   int m_timescale;
   bool m_use_weights;
   std::vector<std::string> m_datafiles;
+  std::string              m_time_index_file;
   std::string              m_static_vertical_pressure_file;
   // add nudging weights for regional nudging update
   std::string              m_weights_file;
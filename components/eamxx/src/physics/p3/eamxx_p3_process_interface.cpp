@@ -4,6 +4,7 @@
 // Needed for p3_init, the only F90 code still used.
 #include "physics/p3/p3_functions.hpp"
 #include "physics/p3/p3_f90.hpp"
+#include "physics/p3/p3_tables_cache.hpp"
 
 #include "ekat/ekat_assert.hpp"
 #include "ekat/util/ekat_units.hpp"
@@ -64,7 +65,17 @@ void P3Microphysics::set_grids(const std::shared_ptr<const GridsManager> grids_m
   constexpr int ps = Pack::n;
 
   // These variables are needed by the interface, but not actually passed to p3_main.
-  add_field<Required>("cldfrac_tot", scalar3d_layout_mid, nondim, grid_name, ps);
+  // If requested, P3 computes the cloud fractions itself, replacing the CldFraction process.
+  m_compute_cld_fraction = m_params.get<bool>("compute_cld_fraction",false);
+  if (m_compute_cld_fraction) {
+    add_field<Required>("cldfrac_liq", scalar3d_layout_mid, nondim, grid_name, ps);
+    add_field<Computed>("cldfrac_tot", scalar3d_layout_mid, nondim, grid_name, ps);
+    add_field<Computed>("cldfrac_ice", scalar3d_layout_mid, nondim, grid_name, ps);
+    add_field<Computed>("cldfrac_tot_for_analysis", scalar3d_layout_mid, nondim, grid_name, ps);
+    add_field<Computed>("cldfrac_ice_for_analysis", scalar3d_layout_mid, nondim, grid_name, ps);
+  } else {
+    add_field<Required>("cldfrac_tot", scalar3d_layout_mid, nondim, grid_name, ps);
+  }
 
 //should we use one pressure only, wet/full?
   add_field<Required>("p_mid",       scalar3d_layout_mid, Pa,     grid_name, ps);
@@ -223,6 +234,12 @@ void P3Microphysics::initialize_impl (const RunType /* run_type */)
   add_postcondition_check<FieldWithinIntervalCheck>(get_field_out("eff_radius_qc"),m_grid,0.0,1.0e2,false);
   add_postcondition_check<FieldWithinIntervalCheck>(get_field_out("eff_radius_qi"),m_grid,0.0,5.0e3,false);
   add_postcondition_check<FieldWithinIntervalCheck>(get_field_out("eff_radius_qr"),m_grid,0.0,5.0e3,false);
+  if (m_compute_cld_fraction) {
+    add_postcondition_check<FieldWithinIntervalCheck>(get_field_out("cldfrac_ice"),m_grid,0.0,1.0,false);
+    add_postcondition_check<FieldWithinIntervalCheck>(get_field_out("cldfrac_tot"),m_grid,0.0,1.0,false);
+    add_postcondition_check<FieldWithinIntervalCheck>(get_field_out("cldfrac_ice_for_analysis"),m_grid,0.0,1.0,false);
+    add_postcondition_check<FieldWithinIntervalCheck>(get_field_out("cldfrac_tot_for_analysis"),m_grid,0.0,1.0,false);
+  }
 
   // Initialize p3
   p3::p3_init(/* write_tables = */ false,
@@ -238,7 +255,9 @@ void P3Microphysics::initialize_impl (const RunType /* run_type */)
   const  auto& pseudo_density = get_field_in("pseudo_density").get_view<const Pack**>();
   const  auto& pseudo_density_dry = get_field_in("pseudo_density_dry").get_view<const Pack**>();
   const  auto& T_atm          = get_field_out("T_mid").get_view<Pack**>();
-  const  auto& cld_frac_t     = get_field_in("cldfrac_tot").get_view<const Pack**>();
+  const  auto& cld_frac_t     = m_compute_cld_fraction
+                              ? get_field_out("cldfrac_tot").get_view<const Pack**>()
+                              : get_field_in("cldfrac_tot").get_view<const Pack**>();
   const  auto& qv             = get_field_out("qv").get_view<Pack**>();
   const  auto& qc             = get_field_out("qc").get_view<Pack**>();
   const  auto& nc             = get_field_out("nc").get_view<Pack**>();
@@ -265,6 +284,17 @@ void P3Microphysics::initialize_impl (const RunType /* run_type */)
                         T_atm,cld_frac_t,
                         qv, qc, nc, qr, nr, qi, qm, ni, bm, qv_prev,
                         inv_exner, th_atm, cld_frac_l, cld_frac_i, cld_frac_r, dz);
+  if (m_compute_cld_fraction) {
+    // Same thresholds (and defaults) as in CldFraction
+    const Real ice_threshold      = m_params.get<double>("ice_cloud_threshold",1e-12);
+    const Real ice_4out_threshold = m_params.get<double>("ice_cloud_for_analysis_threshold",1e-5);
+    p3_preproc.set_cld_fraction_variables(ice_threshold,ice_4out_threshold,
+                                          get_field_in("cldfrac_liq").get_view<const Pack**>(),
+                                          get_field_out("cldfrac_ice").get_view<Pack**>(),
+                                          get_field_out("cldfrac_tot").get_view<Pack**>(),
+                                          get_field_out("cldfrac_ice_for_analysis").get_view<Pack**>(),
+                                          get_field_out("cldfrac_tot_for_analysis").get_view<Pack**>());
+  }
   // --Prognostic State Variables:
   prog_state.qc     = p3_preproc.qc;
   prog_state.nc     = p3_preproc.nc;
@@ -334,10 +364,18 @@ void P3Microphysics::initialize_impl (const RunType /* run_type */)
   }
 
   // Load tables
-  P3F::init_kokkos_ice_lookup_tables(lookup_tables.ice_table_vals, lookup_tables.collect_table_vals);
-  P3F::init_kokkos_tables(lookup_tables.vn_table_vals, lookup_tables.vm_table_vals,
-                          lookup_tables.revap_table_vals, lookup_tables.mu_r_table_vals,
-                          lookup_tables.dnu_table_vals);
+  const auto tables_cache = m_params.get<std::string>("lookup_tables_cache","");
+  if (tables_cache!="") {
+    m_tables_node_data = p3::init_lookup_tables_cached(get_comm(), tables_cache, lookup_tables);
+    m_atm_logger->info("[EAMxx::P3] lookup tables stored in node-shared memory ("
+        + std::to_string(m_tables_node_data->size_in_bytes()) + " bytes), saving "
+        + std::to_string(m_tables_node_data->node_bytes_saved()) + " bytes on the root node.");
+  } else {
+    P3F::init_kokkos_ice_lookup_tables(lookup_tables.ice_table_vals, lookup_tables.collect_table_vals);
+    P3F::init_kokkos_tables(lookup_tables.vn_table_vals, lookup_tables.vm_table_vals,
+                            lookup_tables.revap_table_vals, lookup_tables.mu_r_table_vals,
+                            lookup_tables.dnu_table_vals);
+  }
 
   // Setup WSM for internal local variables
   const auto policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nk_pack);
@@ -5,6 +5,7 @@
 #include "ekat/ekat_parameter_list.hpp"
 #include "physics/p3/p3_functions.hpp"
 #include "share/util/scream_common_physics_functions.hpp"
+#include "share/util/eamxx_node_shared_data.hpp"
 
 #include <string>
 
@@ -65,6 +66,23 @@ public:
     // Functor for Kokkos loop to pre-process every run step
     KOKKOS_INLINE_FUNCTION
     void operator()(const int icol) const {
+      if (compute_cld_frac) {
+        // Same as CldFraction::run_impl, fused here to save a separate pass over the column.
+        // Note: this must use wet qi, and be done for the whole column before
+        //       computing the rain cloud fraction below.
+        for (int ipack=0;ipack<m_npack;ipack++) {
+          const Spack& qi_pack(qi(icol,ipack));
+          const Spack& liq_cld_frac_pack(liq_cld_frac(icol,ipack));
+
+          ice_cld_frac(icol,ipack) = 0.0;
+          ice_cld_frac(icol,ipack).set(qi_pack > ice_cld_threshold, 1.0);
+          ice_cld_frac_4out(icol,ipack) = 0.0;
+          ice_cld_frac_4out(icol,ipack).set(qi_pack > ice_cld_4out_threshold, 1.0);
+
+          tot_cld_frac(icol,ipack) = ekat::max(ice_cld_frac(icol,ipack),liq_cld_frac_pack);
+          tot_cld_frac_4out(icol,ipack) = ekat::max(ice_cld_frac_4out(icol,ipack),liq_cld_frac_pack);
+        }
+      }
       for (int ipack=0;ipack<m_npack;ipack++) {
         // The ipack slice of input variables used more than once
         const Spack& pmid_pack(pmid(icol,ipack));
@@ -152,6 +170,15 @@ public:
     view_2d       cld_frac_i;
     view_2d       cld_frac_r;
     view_2d       dz;
+    // Only used if cloud fraction is computed here (rather than by CldFraction)
+    bool          compute_cld_frac = false;
+    Real          ice_cld_threshold;
+    Real          ice_cld_4out_threshold;
+    view_2d_const liq_cld_frac;
+    view_2d       ice_cld_frac;
+    view_2d       tot_cld_frac;
+    view_2d       ice_cld_frac_4out;
+    view_2d       tot_cld_frac_4out;
     // Assigning local variables
     void set_variables(const int ncol, const int npack,
            const view_2d_const& pmid_, const view_2d_const& pmid_dry_,
@@ -191,6 +218,25 @@ public:
       cld_frac_r = cld_frac_r_;
       dz = dz_;
     } // set_variables
+
+    // Compute cldfrac_tot (as well as ice and "for analysis" cld fractions) before preprocessing.
+    // Note: cld_frac_t set in set_variables must be a const alias of tot_cld_frac_
+    void set_cld_fraction_variables (const Real ice_cld_threshold_, const Real ice_cld_4out_threshold_,
+                                     const view_2d_const& liq_cld_frac_,
+                                     const view_2d& ice_cld_frac_, const view_2d& tot_cld_frac_,
+                                     const view_2d& ice_cld_frac_4out_, const view_2d& tot_cld_frac_4out_)
+    {
+      compute_cld_frac       = true;
+      ice_cld_threshold      = ice_cld_threshold_;
+      ice_cld_4out_threshold = ice_cld_4out_threshold_;
+      // IN
+      liq_cld_frac      = liq_cld_frac_;
+      // OUT
+      ice_cld_frac      = ice_cld_frac_;
+      tot_cld_frac      = tot_cld_frac_;
+      ice_cld_frac_4out = ice_cld_frac_4out_;
+      tot_cld_frac_4out = tot_cld_frac_4out_;
+    }
   }; // p3_preamble
   /* --------------------------------------------------------------------------------------------*/
   // Most individual processes have a post-processing step that derives variables needed by the rest
@@ -407,6 +453,8 @@ protected:
   P3F::P3DiagnosticOutputs diag_outputs;
   P3F::P3HistoryOnly       history_only;
   P3F::P3LookupTables      lookup_tables;
+  // Node-shared memory backing the lookup tables (if read via the tables cache)
+  std::shared_ptr<NodeSharedData> m_tables_node_data;
   P3F::P3Infrastructure    infrastructure;
   P3F::P3Runtime           runtime_options;
   p3_preamble              p3_preproc;
@@ -415,6 +463,12 @@ protected:
   // WSM for internal local variables
   ekat::WorkspaceManager<Spack, KT::Device> workspace_mgr;
 
+  // If true, P3 computes the cloud fractions itself (in the preprocessing step),
+  // so that the CldFraction process can be removed from the mac_mic group.
+  // Note: SHOC is not fused in as well, since it is a separate atm process, whose
+  //       run step also does its own property checks and tendency bookkeeping.
+  bool m_compute_cld_fraction = false;
+
   std::shared_ptr<const AbstractGrid>   m_grid;
   // Iteration count is internal to P3 and keeps track of the number of times p3_main has been called.
   // infrastructure.it is passed as an arguement to p3_main and is used for identifying which iteration an error occurs.
@@ -13,7 +13,7 @@ void P3Microphysics::run_impl (const double dt)
     Kokkos::RangePolicy<>(0,m_num_cols),
     p3_preproc
   ); // Kokkos::parallel_for(p3_main_local_vals)
-  Kokkos::fence();
+  debug_fence();
 
   // Update the variables in the p3 input structures with local values.
 
@@ -24,9 +24,11 @@ void P3Microphysics::run_impl (const double dt)
   workspace_mgr.reset_internals();
 
   // Run p3 main
-  get_field_out("micro_liq_ice_exchange").deep_copy(0.0);
-  get_field_out("micro_vap_liq_exchange").deep_copy(0.0);
-  get_field_out("micro_vap_ice_exchange").deep_copy(0.0);
+  // Note: Field::deep_copy fences, so zero out the views asynchronously instead
+  const KT::ExeSpace exec_space;
+  Kokkos::deep_copy(exec_space,history_only.liq_ice_exchange,Spack(0));
+  Kokkos::deep_copy(exec_space,history_only.vap_liq_exchange,Spack(0));
+  Kokkos::deep_copy(exec_space,history_only.vap_ice_exchange,Spack(0));
 
   P3F::p3_main(runtime_options, prog_state, diag_inputs, diag_outputs, infrastructure,
                history_only, lookup_tables, workspace_mgr, m_num_cols, m_num_levs);
@@ -37,7 +39,7 @@ void P3Microphysics::run_impl (const double dt)
     Kokkos::RangePolicy<>(0,m_num_cols),
     p3_postproc
   ); // Kokkos::parallel_for(p3_main_local_vals)
-  Kokkos::fence();
+  debug_fence();
 }
 
 } // namespace scream
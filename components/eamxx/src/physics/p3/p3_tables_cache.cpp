@@ -0,0 +1,248 @@
+#include "physics/p3/p3_tables_cache.hpp"
+
+#include "share/util/scream_timing.hpp"
+
+#include "ekat/ekat_assert.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace scream {
+namespace p3 {
+
+namespace {
+
+using P3F = Functions<Real,DefaultDevice>;
+using P3C = P3F::P3C;
+
+// Increase this if the layout of the cache file changes
+constexpr int cache_format = 2;
+constexpr int num_tables = 7;
+
+struct CacheHeader {
+  char magic[8];
+  char version[16];
+  int  format;
+  int  real_size;
+  int  sizes[num_tables];
+  // Hash of the sources the tables are built from, and checksum of the tables
+  std::uint64_t params_hash;
+  std::uint64_t checksum;
+};
+
+// 64-bit FNV-1a hash of a sequence of bytes
+std::uint64_t fnv1a (const void* bytes, const size_t n, std::uint64_t hash = 14695981039346656037ULL)
+{
+  const auto c = reinterpret_cast<const unsigned char*>(bytes);
+  for (size_t i=0; i<n; ++i) {
+    hash ^= c[i];
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+// The ice tables are built from the P3 lookup table file, so a cache built from a
+// different (or since modified) file must not be used.
+std::uint64_t compute_params_hash ()
+{
+  const std::string src = std::string(P3C::p3_lookup_base) + P3C::p3_version;
+  std::int64_t stats[2] = {-1, -1};
+  struct stat st;
+  if (stat(src.c_str(),&st)==0) {
+    stats[0] = st.st_size;
+    stats[1] = st.st_mtime;
+  }
+  const auto hash = fnv1a(src.data(),src.size());
+  return fnv1a(stats,sizeof(stats),hash);
+}
+
+// Number of entries in a table (all tables have compile-time extents)
+template<typename ViewT>
+int table_size () {
+  using HostUnmanaged = Kokkos::View<typename ViewT::non_const_data_type,Kokkos::HostSpace,Kokkos::MemoryUnmanaged>;
+  return HostUnmanaged(nullptr).size();
+}
+
+CacheHeader make_header ()
+{
+  CacheHeader h;
+  std::memset(&h,0,sizeof(CacheHeader));
+  std::memcpy(h.magic,"P3TABLES",8);
+  std::strncpy(h.version,P3C::p3_version,sizeof(h.version)-1);
+  h.format    = cache_format;
+  h.real_size = sizeof(Real);
+  // Note: the order must match the one in pack_tables/unpack_tables
+  h.sizes[0] = table_size<P3F::view_ice_table>();
+  h.sizes[1] = table_size<P3F::view_collect_table>();
+  h.sizes[2] = table_size<P3F::view_1d_table>();
+  h.sizes[3] = table_size<P3F::view_2d_table>();
+  h.sizes[4] = table_size<P3F::view_2d_table>();
+  h.sizes[5] = table_size<P3F::view_2d_table>();
+  h.sizes[6] = table_size<P3F::view_dnu_table>();
+  h.params_hash = compute_params_hash();
+  // The checksum is set once the tables are available
+  h.checksum  = 0;
+  return h;
+}
+
+int total_size (const CacheHeader& h)
+{
+  int size = 0;
+  for (int i=0; i<num_tables; ++i) {
+    size += h.sizes[i];
+  }
+  return size;
+}
+
+template<typename ViewT>
+void pack_table (const ViewT& table, Real*& data)
+{
+  const auto table_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),table);
+  std::copy(table_h.data(),table_h.data()+table_h.size(),data);
+  data += table_h.size();
+}
+
+template<typename ViewT>
+void unpack_table (ViewT& table, const std::string& name, const Real*& data)
+{
+  using ExeSpace = typename ViewT::execution_space;
+  if (Kokkos::SpaceAccessibility<ExeSpace,Kokkos::HostSpace>::accessible) {
+    // Read the tables directly from node-shared memory
+    table = ViewT(data);
+  } else {
+    using DeviceTable = typename ViewT::non_const_type;
+    const auto table_d = DeviceTable(name);
+    const auto table_h = Kokkos::create_mirror_view(table_d);
+    std::copy(data,data+table_h.size(),table_h.data());
+    Kokkos::deep_copy(table_d,table_h);
+    table = table_d;
+  }
+  data += table.size();
+}
+
+void pack_tables (const P3F::P3LookupTables& tables, std::vector<Real>& buf)
+{
+  Real* data = buf.data();
+  pack_table(tables.ice_table_vals,data);
+  pack_table(tables.collect_table_vals,data);
+  pack_table(tables.mu_r_table_vals,data);
+  pack_table(tables.vn_table_vals,data);
+  pack_table(tables.vm_table_vals,data);
+  pack_table(tables.revap_table_vals,data);
+  pack_table(tables.dnu_table_vals,data);
+}
+
+void unpack_tables (P3F::P3LookupTables& tables, const Real* data)
+{
+  unpack_table(tables.ice_table_vals,"ice_table_vals",data);
+  unpack_table(tables.collect_table_vals,"collect_table_vals",data);
+  unpack_table(tables.mu_r_table_vals,"mu_r_table_vals",data);
+  unpack_table(tables.vn_table_vals,"vn_table_vals",data);
+  unpack_table(tables.vm_table_vals,"vm_table_vals",data);
+  unpack_table(tables.revap_table_vals,"revap_table_vals",data);
+  unpack_table(tables.dnu_table_vals,"dnu",data);
+}
+
+// Returns false if the file does not exist, is incomplete, does not match the expected
+// header, or its tables do not match the checksum stored in its header
+bool read_cache (const std::string& cache_file, const CacheHeader& expected, Real* data, const int size)
+{
+  std::ifstream ifs(cache_file,std::ios::binary);
+  if (not ifs.good()) {
+    return false;
+  }
+  CacheHeader h;
+  ifs.read(reinterpret_cast<char*>(&h),sizeof(CacheHeader));
+  const auto checksum = h.checksum;
+  h.checksum = expected.checksum;
+  if (not ifs.good() or std::memcmp(&h,&expected,sizeof(CacheHeader))!=0) {
+    return false;
+  }
+  ifs.read(reinterpret_cast<char*>(data),size*sizeof(Real));
+  return static_cast<size_t>(ifs.gcount())==size*sizeof(Real) and
+         fnv1a(data,size*sizeof(Real))==checksum;
+}
+
+// Write to a temporary file first, so that other readers never see a partial cache.
+// The temporary file name is unique to this process, so that concurrent runs sharing
+// the same cache file do not write to the same temporary file.
+void write_cache (const std::string& cache_file, CacheHeader h, const std::vector<Real>& buf)
+{
+  char host[256] = {0};
+  gethostname(host,sizeof(host)-1);
+  const std::string tmp_file = cache_file + ".tmp." + host + "." + std::to_string(getpid());
+  h.checksum = fnv1a(buf.data(),buf.size()*sizeof(Real));
+  {
+    std::ofstream ofs(tmp_file,std::ios::binary);
+    ofs.write(reinterpret_cast<const char*>(&h),sizeof(CacheHeader));
+    ofs.write(reinterpret_cast<const char*>(buf.data()),buf.size()*sizeof(Real));
+    if (not ofs.good()) {
+      std::cout << "WARNING! Could not write P3 tables cache file " << tmp_file << ".\n";
+      ofs.close();
+      std::remove(tmp_file.c_str());
+      return;
+    }
+  }
+  if (std::rename(tmp_file.c_str(),cache_file.c_str())!=0) {
+    std::cout << "WARNING! Could not move " << tmp_file << " to " << cache_file << ".\n";
+    std::remove(tmp_file.c_str());
+  }
+}
+
+} // anonymous namespace
+
+std::shared_ptr<NodeSharedData>
+init_lookup_tables_cached (const ekat::Comm& comm,
+                           const std::string& cache_file,
+                           P3F::P3LookupTables& tables)
+{
+  start_timer("EAMxx::P3::init_lookup_tables_cached");
+
+  const auto header = make_header();
+  const int size = total_size(header);
+  auto node_data = std::make_shared<NodeSharedData>(comm,size*sizeof(Real));
+
+  // Only the first rank on each node reads the cache. If any of them fails,
+  // the cache is rebuilt (e.g., it was never built, or the tables changed).
+  int ok = 1;
+  if (node_data->am_i_node_root()) {
+    ok = read_cache(cache_file,header,node_data->get_data_for_write<Real>(),size) ? 1 : 0;
+  }
+  int all_ok;
+  comm.all_reduce(&ok,&all_ok,1,MPI_MIN);
+
+  if (all_ok!=1) {
+    std::vector<Real> buf(size);
+    if (comm.am_i_root()) {
+      std::cout << "P3 tables cache " << cache_file << " is missing or out of date. Regenerating it.\n";
+      P3F::P3LookupTables src;
+      P3F::init_kokkos_ice_lookup_tables(src.ice_table_vals, src.collect_table_vals);
+      P3F::init_kokkos_tables(src.vn_table_vals, src.vm_table_vals,
+                              src.revap_table_vals, src.mu_r_table_vals,
+                              src.dnu_table_vals);
+      pack_tables(src,buf);
+      write_cache(cache_file,header,buf);
+    }
+    comm.broadcast(buf.data(),size,comm.root_rank());
+    if (node_data->am_i_node_root()) {
+      std::copy(buf.begin(),buf.end(),node_data->get_data_for_write<Real>());
+    }
+  }
+  node_data->finalize_write();
+
+  unpack_tables(tables,node_data->get_data<Real>());
+
+  stop_timer("EAMxx::P3::init_lookup_tables_cached");
+  return node_data;
+}
+
+} // namespace p3
+} // namespace scream
@@ -0,0 +1,48 @@
+#ifndef P3_TABLES_CACHE_HPP
+#define P3_TABLES_CACHE_HPP
+
+#include "physics/p3/p3_functions.hpp"
+#include "share/util/eamxx_node_shared_data.hpp"
+
+#include "ekat/mpi/ekat_comm.hpp"
+
+#include <memory>
+#include <string>
+
+namespace scream {
+namespace p3 {
+
+/*
+ * Initialization of the P3 lookup tables via a binary cache file.
+ *
+ * Building the ice tables requires parsing a large ASCII file, which, when
+ * done on every rank, is slow and puts a lot of pressure on the file system
+ * at scale. Instead, all tables (ice, collect, mu_r, vn, vm, revap, dnu) are
+ * stored in a single binary file, whose header records the table version,
+ * the floating point precision, the size of each table, a hash of the lookup
+ * table file the tables are built from (its path, size and modification
+ * time), and a checksum of the tables themselves.
+ *
+ * The cache file is read by one rank per node, directly into node-shared
+ * memory. If the file is missing, or its header does not match the tables
+ * expected by this build, or the tables do not match the checksum, the root
+ * rank builds the tables from the original sources, broadcasts them to all
+ * ranks, and (re)writes the cache file.
+ *
+ * If the default device can access host memory, the tables are views of the
+ * node-shared memory, so that they are stored only once per node. Otherwise,
+ * each rank copies them to device. Either way, the returned object must be
+ * kept alive as long as the tables are in use.
+ *
+ * Note: p3_init must have been called before this function.
+ */
+
+std::shared_ptr<NodeSharedData>
+init_lookup_tables_cached (const ekat::Comm& comm,
+                           const std::string& cache_file,
+                           Functions<Real,DefaultDevice>::P3LookupTables& tables);
+
+} // namespace p3
+} // namespace scream
+
+#endif // P3_TABLES_CACHE_HPP
@@ -5,6 +5,8 @@
 #include "ekat/kokkos/ekat_kokkos_utils.hpp"
 #include "p3_functions.hpp"
 #include "p3_functions_f90.hpp"
+#include "p3_f90.hpp"
+#include "p3_tables_cache.hpp"
 
 #include "p3_unit_tests_common.hpp"
 
@@ -12,6 +14,8 @@
 #include <array>
 #include <algorithm>
 #include <random>
+#include <cstdio>
+#include <fstream>
 
 namespace scream {
 namespace p3 {
@@ -61,6 +65,63 @@ struct UnitWrap::UnitTest<D>::TestTableIce {
     }
   }
 
+  template <typename View>
+  static void compare_tables(const View& v1, const View& v2)
+  {
+    const auto v1_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), v1);
+    const auto v2_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), v2);
+    REQUIRE(v1_h.size() == v2_h.size());
+    for (size_t i = 0; i < v1_h.size(); ++i) {
+      REQUIRE(v1_h.data()[i] == v2_h.data()[i]);
+    }
+  }
+
+  static void test_cached_lookup_tables()
+  {
+    p3_init();
+
+    // Build tables the standard way
+    typename Functions::P3LookupTables ref;
+    Functions::init_kokkos_ice_lookup_tables(ref.ice_table_vals, ref.collect_table_vals);
+    Functions::init_kokkos_tables(ref.vn_table_vals, ref.vm_table_vals, ref.revap_table_vals,
+                                  ref.mu_r_table_vals, ref.dnu_table_vals);
+
+    // First call generates the cache, second call reads it, third call finds
+    // the cache corrupted (so that its checksum does not match) and regenerates it
+    ekat::Comm comm(MPI_COMM_WORLD);
+    const std::string cache_file = "p3_lookup_tables_test.cache";
+    if (comm.am_i_root()) {
+      std::remove(cache_file.c_str());
+    }
+    comm.barrier();
+    for (int pass = 0; pass < 3; ++pass) {
+      if (pass == 2) {
+        if (comm.am_i_root()) {
+          std::fstream fs(cache_file, std::ios::in | std::ios::out | std::ios::binary);
+          char c;
+          fs.seekg(-1, std::ios::end);
+          fs.get(c);
+          fs.seekp(-1, std::ios::end);
+          fs.put(~c);
+        }
+        comm.barrier();
+      }
+      typename Functions::P3LookupTables tables;
+      const auto node_data = init_lookup_tables_cached(comm, cache_file, tables);
+      compare_tables(tables.ice_table_vals, ref.ice_table_vals);
+      compare_tables(tables.collect_table_vals, ref.collect_table_vals);
+      compare_tables(tables.mu_r_table_vals, ref.mu_r_table_vals);
+      compare_tables(tables.vn_table_vals, ref.vn_table_vals);
+      compare_tables(tables.vm_table_vals, ref.vm_table_vals);
+      compare_tables(tables.revap_table_vals, ref.revap_table_vals);
+      compare_tables(tables.dnu_table_vals, ref.dnu_table_vals);
+    }
+    comm.barrier();
+    if (comm.am_i_root()) {
+      std::remove(cache_file.c_str());
+    }
+  }
+
   template <typename View>
   static void init_table_linear_dimension(View& table, int linear_dimension)
   {
@@ -346,6 +407,7 @@ TEST_CASE("p3_ice_tables", "[p3_functions]")
   using TTI = scream::p3::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::TestTableIce;
 
   TTI::test_read_lookup_tables_bfb();
+  TTI::test_cached_lookup_tables();
   TTI::run_phys();
   TTI::run_bfb();
 }
@@ -463,7 +463,7 @@ void SHOCMacrophysics::run_impl (const double dt)
   Kokkos::parallel_for("shoc_preprocess",
                        scan_policy,
                        shoc_preprocess);
-  Kokkos::fence();
+  debug_fence();
 
   if (m_params.get<bool>("apply_tms", false)) {
     apply_turbulent_mountain_stress();
@@ -494,7 +494,7 @@ void SHOCMacrophysics::run_impl (const double dt)
   Kokkos::parallel_for("shoc_postprocess",
                        default_policy,
                        shoc_postprocess);
-  Kokkos::fence();
+  debug_fence();
 }
 // =========================================================================================
 void SHOCMacrophysics::finalize_impl()
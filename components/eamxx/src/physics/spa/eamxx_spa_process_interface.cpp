@@ -188,6 +188,18 @@ void SPA::initialize_impl (const RunType /* run_type */)
   SPATimeState.current_month = ts.get_month();
   SPAFunc::update_spa_timestate(m_spa_data_file,m_nswbands,m_nlwbands,ts,SPAHorizInterp,SPATimeState,SPAData_start,SPAData_end);
 
+  // If requested, only recompute the vertical interpolation weights when the source/target
+  // pressure changed by more than the given relative tolerance, or every N steps (if N>0).
+  m_lazy_vert_interp = m_params.get<bool>("spa_lazy_vert_interp",false);
+  if (m_lazy_vert_interp) {
+    m_lazy_vert_interp_tol       = m_params.get<double>("spa_lazy_vert_interp_tol",1e-3);
+    m_lazy_vert_interp_max_steps = m_params.get<int>("spa_lazy_vert_interp_max_steps",0);
+    EKAT_REQUIRE_MSG (m_lazy_vert_interp_tol>=0,
+        "Error! Invalid value for spa_lazy_vert_interp_tol. Must be non-negative.\n"
+        "  - spa_lazy_vert_interp_tol: " + std::to_string(m_lazy_vert_interp_tol) + "\n");
+    SPAVertBracket.init(m_num_cols,m_num_levs);
+  }
+
   // Set property checks for fields in this process
   using Interval = FieldWithinIntervalCheck;
   const auto eps = std::numeric_limits<double>::epsilon();
@@ -212,8 +224,14 @@ void SPA::run_impl (const double dt)
 
   // Call the main SPA routine to get interpolated aerosol forcings.
   const auto& pmid_tgt = get_field_in("p_mid").get_view<const Pack**>();
-  SPAFunc::spa_main(SPATimeState, pmid_tgt, m_buffer.p_mid_src,
-                    SPAData_start,SPAData_end,m_buffer.spa_temp,SPAData_out);
+  if (m_lazy_vert_interp) {
+    SPAFunc::spa_main_lazy(SPATimeState, pmid_tgt, m_buffer.p_mid_src,
+                           SPAData_start,SPAData_end,m_buffer.spa_temp,SPAData_out,
+                           m_lazy_vert_interp_tol,m_lazy_vert_interp_max_steps,SPAVertBracket);
+  } else {
+    SPAFunc::spa_main(SPATimeState, pmid_tgt, m_buffer.p_mid_src,
+                      SPAData_start,SPAData_end,m_buffer.spa_temp,SPAData_out);
+  }
 }
 
 // =========================================================================================
@@ -100,6 +100,12 @@ protected:
   SPAFunc::SPAInput         SPAData_end;
   SPAFunc::SPAOutput        SPAData_out;
 
+  // Lazy vertical interpolation (see SPAFunctions::spa_main_lazy)
+  bool                      m_lazy_vert_interp;
+  Real                      m_lazy_vert_interp_tol;
+  int                       m_lazy_vert_interp_max_steps;
+  SPAFunc::SPAVertBracket   SPAVertBracket;
+
   std::shared_ptr<const AbstractGrid>   m_grid;
 }; // class SPA 
 
@@ -160,6 +160,39 @@ struct SPAFunctions
     ekat::Comm m_comm;
 
   }; // SPAHorizInterp
+
+  struct SPAVertBracket {
+    // This structure stores, for each column and target level, the index of the
+    // source level right above it and the corresponding interpolation weight.
+    // It is used by spa_main_lazy, which only recomputes it when the source or
+    // target pressure have changed "enough" since the last update.
+    SPAVertBracket() = default;
+    SPAVertBracket(const int ncols_, const int nlevs_tgt_)
+    {
+      init(ncols_,nlevs_tgt_);
+    }
+
+    void init(const int ncols_, const int nlevs_tgt_)
+    {
+      idx       = view_2d<int>("",ncols_,nlevs_tgt_);
+      wgt       = view_2d<Real>("",ncols_,nlevs_tgt_);
+      p_tgt_ref = view_2d<Real>("",ncols_,nlevs_tgt_);
+      ps_ref    = view_1d<Real>("",ncols_);
+      valid = false;
+    }
+
+    view_2d<int>   idx;        // Source level k such that p_src(k)<=p_tgt<p_src(k+1)
+    view_2d<Real>  wgt;        // (p_tgt-p_src(k)) / (p_src(k+1)-p_src(k))
+    view_2d<Real>  p_tgt_ref;  // Target pressure at last update
+    view_1d<Real>  ps_ref;     // Source surface pressure at last update
+
+    // Month of the beg/end data used at last update
+    int  month = -1;
+    // Number of calls to spa_main_lazy since last update
+    int  steps_since_update = 0;
+    // Whether idx/wgt have been computed at least once
+    bool valid = false;
+  }; // SPAVertBracket
   /* ------------------------------------------------------------------------------------------- */
   // SPA routines
   static void spa_main(
@@ -171,6 +204,24 @@ struct SPAFunctions
     const SPAInput&   data_tmp,         // Temporary
     const SPAOutput&  data_out);
 
+  // Same as spa_main, but the vertical bracketing of the target levels is only
+  // recomputed if the relative change in p_tgt or in the source surface pressure
+  // since the last update exceeds tol, if the month changed, or if the last
+  // update was at least max_steps calls ago (max_steps<=0 means no limit).
+  // On all other steps, the time and vertical interpolation are performed in a
+  // single kernel, using the stored bracketing.
+  static void spa_main_lazy(
+    const SPATimeState& time_state,
+    const view_2d<const Spack>& p_tgt,
+    const view_2d<      Spack>& p_src,  // Temporary
+    const SPAInput&   data_beg,
+    const SPAInput&   data_end,
+    const SPAInput&   data_tmp,         // Temporary
+    const SPAOutput&  data_out,
+    const Real        tol,
+    const int         max_steps,
+          SPAVertBracket& bracket);
+
   static void get_remap_weights_from_file(
     const std::string&             remap_file_name,
     const gid_type                 min_dof,
@@ -219,6 +270,28 @@ struct SPAFunctions
       const SPAData&  data_in,
       const SPAData&  data_out);
 
+  // The following three are called during spa_main_lazy
+  static Real compute_vertical_bracket_change (
+      const SPATimeState& time_state,
+      const view_2d<const Spack>& p_tgt,
+      const SPAInput& data_beg,
+      const SPAInput& data_end,
+      const SPAVertBracket& bracket);
+
+  static void compute_vertical_bracket (
+      const int nlevs_src,
+      const view_1d<const Real>& ps_src,
+      const view_2d<const Spack>& p_src,
+      const view_2d<const Spack>& p_tgt,
+      const SPAVertBracket& bracket);
+
+  static void perform_time_and_vertical_interpolation (
+      const SPATimeState& time_state,
+      const SPAInput&  data_beg,
+      const SPAInput&  data_end,
+      const SPAVertBracket& bracket,
+      const SPAOutput& data_out);
+
   // Return the subcolumn of the proper variable, where ivar
   // is a condensed idx for var and possibly band. In particular:
   //  - ivar=0: return CCN
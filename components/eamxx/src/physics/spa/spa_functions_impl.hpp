@@ -135,6 +135,67 @@ void SPAFunctions<S,D>
   perform_vertical_interpolation(p_src, p_tgt, data_tmp.data, data_out);
 }
 
+/*-----------------------------------------------------------------*/
+template <typename S, typename D>
+void SPAFunctions<S,D>
+::spa_main_lazy(
+  const SPATimeState& time_state,
+  const view_2d<const Spack>& p_tgt,
+  const view_2d<      Spack>& p_src,
+  const SPAInput&   data_beg,
+  const SPAInput&   data_end,
+  const SPAInput&   data_tmp,
+  const SPAOutput&  data_out,
+  const Real        tol,
+  const int         max_steps,
+        SPAVertBracket& bracket)
+{
+  // Same sanity checks as in spa_main
+  EKAT_REQUIRE_MSG (
+      data_end.data.nswbands==data_beg.data.nswbands &&
+      data_end.data.nlwbands==data_beg.data.nlwbands &&
+      data_end.data.nswbands==data_out.nswbands &&
+      data_end.data.nlwbands==data_out.nlwbands,
+      "Error! SPAInput and SPAOutput data structs must have the same number of SW/LW bands.\n");
+  EKAT_REQUIRE_MSG (
+      data_end.data.ncols==data_beg.data.ncols &&
+      data_end.data.nlevs==data_beg.data.nlevs &&
+      data_end.data.ncols==data_out.ncols,
+      "Error! SPAInput and SPAOutput data structs must have the same number of columns,\n"
+      "       and SPAInput data structs must have the same number of levels.\n");
+  EKAT_REQUIRE_MSG (
+      bracket.idx.extent_int(0)==data_out.ncols &&
+      bracket.idx.extent_int(1)==data_out.nlevs,
+      "Error! SPAVertBracket was not initialized with the output data sizes.\n");
+
+  // Step 1. Check if the vertical bracketing needs to be recomputed. The
+  //         check on p_tgt/PS is only done if nothing else triggered the update.
+  bool update = not bracket.valid ||
+                bracket.month!=time_state.current_month ||
+                (max_steps>0 && bracket.steps_since_update>=max_steps);
+  if (not update) {
+    update = compute_vertical_bracket_change(time_state,p_tgt,data_beg,data_end,bracket) > tol;
+  }
+
+  // Step 2. If needed, compute source pressure levels at current time, and
+  //         recompute the vertical bracketing of the target levels.
+  if (update) {
+    start_timer("EAMxx::SPA::spa_main_lazy::update_bracket");
+    perform_time_interpolation(time_state,data_beg,data_end,data_tmp);
+    compute_source_pressure_levels(data_tmp.PS, p_src, data_beg.hyam, data_beg.hybm);
+    compute_vertical_bracket(data_beg.data.nlevs, data_tmp.PS, p_src, p_tgt, bracket);
+
+    bracket.month = time_state.current_month;
+    bracket.steps_since_update = 0;
+    bracket.valid = true;
+    stop_timer("EAMxx::SPA::spa_main_lazy::update_bracket");
+  }
+  ++bracket.steps_since_update;
+
+  // Step 3. Perform time and vertical interpolation in one pass
+  perform_time_and_vertical_interpolation(time_state,data_beg,data_end,bracket,data_out);
+}
+
 /*-----------------------------------------------------------------*/
 template <typename S, typename D>
 void SPAFunctions<S,D>
@@ -295,6 +356,159 @@ perform_vertical_interpolation(
   Kokkos::fence();
 }
 
+/*-----------------------------------------------------------------*/
+template<typename S, typename D>
+Real SPAFunctions<S,D>::
+compute_vertical_bracket_change(
+  const SPATimeState& time_state,
+  const view_2d<const Spack>& p_tgt,
+  const SPAInput& data_beg,
+  const SPAInput& data_end,
+  const SPAVertBracket& bracket)
+{
+  using ExeSpace = typename KT::ExeSpace;
+  using ESU = ekat::ExeSpaceUtils<ExeSpace>;
+
+  const int ncols = bracket.idx.extent(0);
+  const int nlevs_tgt = bracket.idx.extent(1);
+  const auto policy = ESU::get_default_team_policy(ncols, nlevs_tgt);
+
+  const auto delta_t_fraction = (time_state.t_now-time_state.t_beg_month) / time_state.days_this_month;
+  const auto p_tgt_ref = bracket.p_tgt_ref;
+  const auto ps_ref    = bracket.ps_ref;
+  const auto ps_beg    = data_beg.PS;
+  const auto ps_end    = data_end.PS;
+
+  // Max relative change (over all cols/levs) of p_tgt and source PS since the last update
+  Real max_change = 0;
+  Kokkos::parallel_reduce("spa_vert_bracket_change_loop", policy,
+    KOKKOS_LAMBDA(const MemberType& team, Real& change) {
+
+    const int icol = team.league_rank();
+    const auto p_tgt_s = ekat::scalarize(ekat::subview(p_tgt,icol));
+
+    Real col_change = 0;
+    Kokkos::parallel_reduce(Kokkos::TeamVectorRange(team,nlevs_tgt),
+                            [&](const int k, Real& lchange) {
+      const Real dp = Kokkos::fabs(p_tgt_s(k)-p_tgt_ref(icol,k)) / p_tgt_ref(icol,k);
+      lchange = dp>lchange ? dp : lchange;
+    }, Kokkos::Max<Real>(col_change));
+
+    Kokkos::single(Kokkos::PerTeam(team),[&]{
+      const Real ps = linear_interp(ps_beg(icol),ps_end(icol),delta_t_fraction);
+      const Real dps = Kokkos::fabs(ps-ps_ref(icol)) / ps_ref(icol);
+      col_change = dps>col_change ? dps : col_change;
+      change = col_change>change ? col_change : change;
+    });
+  }, Kokkos::Max<Real>(max_change));
+
+  return max_change;
+}
+
+template<typename S, typename D>
+void SPAFunctions<S,D>::
+compute_vertical_bracket(
+  const int nlevs_src,
+  const view_1d<const Real>& ps_src,
+  const view_2d<const Spack>& p_src,
+  const view_2d<const Spack>& p_tgt,
+  const SPAVertBracket& bracket)
+{
+  using ExeSpace = typename KT::ExeSpace;
+  using ESU = ekat::ExeSpaceUtils<ExeSpace>;
+
+  const int ncols = bracket.idx.extent(0);
+  const int nlevs_tgt = bracket.idx.extent(1);
+  const auto policy = ESU::get_default_team_policy(ncols, nlevs_tgt);
+
+  // NOTE: p_src contains the padding levels added in update_spa_data_from_file,
+  //       so that [p_src(0),p_src(nlevs_src-1)] contains all of p_tgt.
+  const auto idx = bracket.idx;
+  const auto wgt = bracket.wgt;
+  const auto p_tgt_ref = bracket.p_tgt_ref;
+  const auto ps_ref = bracket.ps_ref;
+  Kokkos::parallel_for("spa_vert_bracket_loop", policy,
+    KOKKOS_LAMBDA(const MemberType& team) {
+
+    const int icol = team.league_rank();
+    const auto x1 = ekat::scalarize(ekat::subview(p_src,icol));
+    const auto x2 = ekat::scalarize(ekat::subview(p_tgt,icol));
+
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nlevs_tgt),
+                         [&](const int k) {
+      // Find last source level k1 in [0,nlevs_src-2] such that x1(k1)<=x2(k)
+      const Real p = x2(k);
+      int beg = 0, end = nlevs_src-2;
+      while (beg<end) {
+        const int mid = (beg+end+1)/2;
+        if (x1(mid)<=p) {
+          beg = mid;
+        } else {
+          end = mid-1;
+        }
+      }
+      idx(icol,k) = beg;
+      wgt(icol,k) = (p-x1(beg)) / (x1(beg+1)-x1(beg));
+      p_tgt_ref(icol,k) = p;
+    });
+    Kokkos::single(Kokkos::PerTeam(team),[&]{
+      ps_ref(icol) = ps_src(icol);
+    });
+  });
+  Kokkos::fence();
+}
+
+template<typename S, typename D>
+void SPAFunctions<S,D>::
+perform_time_and_vertical_interpolation(
+  const SPATimeState& time_state,
+  const SPAInput&  data_beg,
+  const SPAInput&  data_end,
+  const SPAVertBracket& bracket,
+  const SPAOutput& data_out)
+{
+  using ExeSpace = typename KT::ExeSpace;
+  using ESU = ekat::ExeSpaceUtils<ExeSpace>;
+
+  const int ncols = data_out.ncols;
+  const int nlevs_tgt = data_out.nlevs;
+  const int num_vars = 1+data_out.nswbands*3+data_out.nlwbands;
+
+  const auto delta_t_fraction = (time_state.t_now-time_state.t_beg_month) / time_state.days_this_month;
+  EKAT_REQUIRE_MSG (delta_t_fraction>=0 && delta_t_fraction<=1,
+      "Error! Convex interpolation with coefficient out of [0,1].\n"
+      "  t_now  : " + std::to_string(time_state.t_now) + "\n"
+      "  t_beg  : " + std::to_string(time_state.t_beg_month) + "\n"
+      "  delta_t: " + std::to_string(time_state.days_this_month) + "\n");
+
+  const auto idx = bracket.idx;
+  const auto wgt = bracket.wgt;
+
+  // Interpolate in time only the two source levels bracketing each target level,
+  // then interpolate in the vertical. No temporary source-level data is needed.
+  const int outer_iters = ncols*num_vars;
+  const auto policy = ESU::get_default_team_policy(outer_iters, nlevs_tgt);
+  Kokkos::parallel_for("spa_time_vert_interp_loop", policy,
+    KOKKOS_LAMBDA(const MemberType& team) {
+
+    const int icol = team.league_rank() / num_vars;
+    const int ivar = team.league_rank() % num_vars;
+
+    const auto y_beg = ekat::scalarize(get_var_column(data_beg.data,icol,ivar));
+    const auto y_end = ekat::scalarize(get_var_column(data_end.data,icol,ivar));
+    const auto y_out = ekat::scalarize(get_var_column(data_out,icol,ivar));
+
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nlevs_tgt),
+                         [&](const int k) {
+      const int k1 = idx(icol,k);
+      const Real y1 = linear_interp(y_beg(k1),  y_end(k1),  delta_t_fraction);
+      const Real y2 = linear_interp(y_beg(k1+1),y_end(k1+1),delta_t_fraction);
+      y_out(k) = y1 + (y2-y1)*wgt(icol,k);
+    });
+  });
+  Kokkos::fence();
+}
+
 /*-----------------------------------------------------------------*/
 // Function to set the remap and weights for a one-to-one mapping.
 // This is used when the SPA data and the simulation grid are the
@@ -527,10 +741,9 @@ void SPAFunctions<S,D>
   view_3d<Real> AER_TAU_LW_unpad("",tgt_ncol,nlwbands,tgt_nlev);
   // Apply remap to "unpadded" data
   spa_horiz_map.apply_remap(CCN3_v,CCN3_unpad);
-  spa_horiz_map.apply_remap(AER_G_SW_v, AER_G_SW_unpad);
-  spa_horiz_map.apply_remap(AER_SSA_SW_v, AER_SSA_SW_unpad);
-  spa_horiz_map.apply_remap(AER_TAU_SW_v, AER_TAU_SW_unpad);
-  spa_horiz_map.apply_remap(AER_TAU_LW_v, AER_TAU_LW_unpad);
+  // The aerosol optics are remapped with a single kernel
+  spa_horiz_map.apply_remap({AER_G_SW_v, AER_SSA_SW_v, AER_TAU_SW_v, AER_TAU_LW_v},
+                            {AER_G_SW_unpad, AER_SSA_SW_unpad, AER_TAU_SW_unpad, AER_TAU_LW_unpad});
   stop_timer("EAMxx::SPA::update_spa_data_from_file::apply_remap");
   start_timer("EAMxx::SPA::update_spa_data_from_file::copy_and_pad");
   // Copy unpadded data to SPA data structure, add padding.
@@ -10,6 +10,7 @@
 #include "ekat/util/ekat_test_utils.hpp"
 #include "ekat/ekat_pack.hpp"
 
+#include <limits>
 #include <random>
 
 namespace {
@@ -347,7 +348,96 @@ TEST_CASE("spa_main")
       check_bounds (sv(data_beg_h.aer_tau_lw,i,n),sv(data_out_h.aer_tau_lw,i,n));
     }
   }
-  std::cout << "  -> vert interp, p_tgt!=p_src and extrapolation needed ... OK!\n\n";
+  std::cout << "  -> vert interp, p_tgt!=p_src and extrapolation needed ... OK!\n";
+
+  // ======================================================== //
+  //                Test lazy vert interpolation              //
+  // ======================================================== //
+
+  // 1. With t_now=t_beg, the fused time/vert interpolation with the stored
+  //    bracketing must match the time interp followed by vert interp.
+  std::cout << "  -> lazy vert interp, fused vs unfused\n";
+  spa_time_state.t_now = t_beg.frac_of_year_in_days();
+
+  SPAFunc::SPAVertBracket bracket(ncols,nlevs);
+  SPAFunc::SPAOutput spa_out_lazy(ncols, nlevs, nswbands, nlwbands);
+  SPADataHost data_out_lazy_h(spa_out_lazy);
+  SPAFunc::compute_vertical_bracket(nlevs+2,spa_beg.PS,p_src,p_tgt,bracket);
+  SPAFunc::perform_time_and_vertical_interpolation(spa_time_state,spa_beg,spa_end,bracket,spa_out_lazy);
+  data_out_lazy_h.copy_from_dev(spa_out_lazy);
+
+  const Real tol = std::numeric_limits<Real>::epsilon()*1000;
+  for (int i=0; i<ncols; ++i) {
+    for (int k=0; k<nlevs; ++k) {
+      REQUIRE (data_out_lazy_h.ccn3(i,k) == Approx(data_out_h.ccn3(i,k)).epsilon(tol));
+      for (int n=0; n<nswbands; ++n) {
+        REQUIRE (data_out_lazy_h.aer_g_sw(i,n,k) == Approx(data_out_h.aer_g_sw(i,n,k)).epsilon(tol));
+        REQUIRE (data_out_lazy_h.aer_ssa_sw(i,n,k) == Approx(data_out_h.aer_ssa_sw(i,n,k)).epsilon(tol));
+        REQUIRE (data_out_lazy_h.aer_tau_sw(i,n,k) == Approx(data_out_h.aer_tau_sw(i,n,k)).epsilon(tol));
+      }
+      for (int n=0; n<nlwbands; ++n) {
+        REQUIRE (data_out_lazy_h.aer_tau_lw(i,n,k) == Approx(data_out_h.aer_tau_lw(i,n,k)).epsilon(tol));
+      }
+    }
+  }
+  std::cout << "  -> lazy vert interp, fused vs unfused ................... OK!\n";
+
+  // 2. The bracketing is only recomputed when needed
+  std::cout << "  -> lazy vert interp, bracket updates\n";
+
+  // Set hybrid coords so that p_src=[0, PS/nlevs, ..., PS, 10*PS], which brackets p_tgt
+  auto hyam_h = Kokkos::create_mirror_view(ekat::scalarize(spa_beg.hyam));
+  auto hybm_h = Kokkos::create_mirror_view(ekat::scalarize(spa_beg.hybm));
+  for (int k=0; k<=nlevs; ++k) {
+    hyam_h(k) = 0;
+    hybm_h(k) = Real(k)/nlevs;
+  }
+  hyam_h(nlevs+1) = 0;
+  hybm_h(nlevs+1) = 10;
+  Kokkos::deep_copy(ekat::scalarize(spa_beg.hyam),hyam_h);
+  Kokkos::deep_copy(ekat::scalarize(spa_beg.hybm),hybm_h);
+
+  const Real lazy_tol = 1e-3;
+  SPAFunc::SPAVertBracket lazy_bracket(ncols,nlevs);
+  SPAFunc::spa_main_lazy(spa_time_state,p_tgt,p_src,spa_beg,spa_end,spa_tmp,spa_out_lazy,lazy_tol,3,lazy_bracket);
+  REQUIRE (lazy_bracket.valid);
+  REQUIRE (lazy_bracket.steps_since_update==1);
+
+  // Same inputs: no update
+  SPAFunc::spa_main_lazy(spa_time_state,p_tgt,p_src,spa_beg,spa_end,spa_tmp,spa_out_lazy,lazy_tol,3,lazy_bracket);
+  REQUIRE (lazy_bracket.steps_since_update==2);
+
+  // Change p_tgt by less than the tolerance: no update
+  for (int i=0; i<ncols; ++i) {
+    for (int k=0; k<nlevs; ++k) {
+      p_tgt_h(i,k) *= 1+lazy_tol/2;
+    }
+  }
+  Kokkos::deep_copy(ekat::scalarize(p_tgt),p_tgt_h);
+  SPAFunc::spa_main_lazy(spa_time_state,p_tgt,p_src,spa_beg,spa_end,spa_tmp,spa_out_lazy,lazy_tol,3,lazy_bracket);
+  REQUIRE (lazy_bracket.steps_since_update==3);
+
+  // Max number of steps reached: update
+  SPAFunc::spa_main_lazy(spa_time_state,p_tgt,p_src,spa_beg,spa_end,spa_tmp,spa_out_lazy,lazy_tol,3,lazy_bracket);
+  REQUIRE (lazy_bracket.steps_since_update==1);
+
+  // Change p_tgt by more than the tolerance: update
+  for (int i=0; i<ncols; ++i) {
+    for (int k=0; k<nlevs; ++k) {
+      p_tgt_h(i,k) *= 1+2*lazy_tol;
+    }
+  }
+  Kokkos::deep_copy(ekat::scalarize(p_tgt),p_tgt_h);
+  SPAFunc::spa_main_lazy(spa_time_state,p_tgt,p_src,spa_beg,spa_end,spa_tmp,spa_out_lazy,lazy_tol,3,lazy_bracket);
+  REQUIRE (lazy_bracket.steps_since_update==1);
+
+  // Month change: update
+  SPAFunc::spa_main_lazy(spa_time_state,p_tgt,p_src,spa_beg,spa_end,spa_tmp,spa_out_lazy,lazy_tol,3,lazy_bracket);
+  REQUIRE (lazy_bracket.steps_since_update==2);
+  lazy_bracket.month = -1;
+  SPAFunc::spa_main_lazy(spa_time_state,p_tgt,p_src,spa_beg,spa_end,spa_tmp,spa_out_lazy,lazy_tol,3,lazy_bracket);
+  REQUIRE (lazy_bracket.steps_since_update==1);
+  std::cout << "  -> lazy vert interp, bracket updates .................... OK!\n\n";
 }
 
 // Compute min/max of input over [start,end) indices
@@ -41,6 +41,7 @@ void ZMDeepConvection::set_grids(const std::shared_ptr<const GridsManager> grids
   auto grid = grids_manager->get_grid("Physics");
   const int num_dofs = grid->get_num_local_dofs();
   const int nc = num_dofs;
+  m_num_cols = nc;
 
   using namespace ShortFieldTagsNames;
 
@@ -69,45 +70,65 @@ void ZMDeepConvection::set_grids(const std::shared_ptr<const GridsManager> grids
 void ZMDeepConvection::initialize_impl (const RunType /* run_type */)
 {
   zm_init_f90 (*m_raw_ptrs_in["limcnv_in"], m_raw_ptrs_in["no_deep_pbl_in"]);
+
+  // The Fortran arrays are dimensioned with pcols columns, so batches cannot be larger than that
+  m_pcols = zm_get_pcols_f90();
+  m_batch_size = m_params.get<int>("column_batch_size",m_pcols);
+  EKAT_REQUIRE_MSG (m_batch_size>0 && m_batch_size<=m_pcols,
+      "Error! Invalid value for ZM column_batch_size. Must be in [1," + std::to_string(m_pcols) + "].\n"
+      "  - column_batch_size: " + std::to_string(m_batch_size) + "\n");
+
+  // Batches are copied on their own execution space instance, so that the copies can
+  // overlap with work enqueued on the default instance
+  m_copy_space = Kokkos::Experimental::partition_space(DefaultDevice::execution_space(),1)[0];
+
+  // Each batch buffer holds pcols columns, so that it can be passed as is to Fortran
+  for (const auto& it : m_col_sizes) {
+    const int n = it.second*m_pcols;
+    m_batch_dev_views[it.first]  = batch_dev_view_type("",num_batch_slots,n);
+    m_batch_host_views[it.first] = batch_host_view_type("",num_batch_slots,n);
+  }
 }
 // =========================================================================================
 void ZMDeepConvection::run_impl (const double dt)
 {
-  std::vector<const Real*> in;
-  std::vector<Real*> out;
+  // The batch copies run on m_copy_space, so wait for the work on the default instance
+  // that produced the fields. Note: Fortran only reads the batch buffers, which are
+  // filled from the computed fields, so the required fields are not copied to host.
+  DefaultDevice::execution_space().fence();
 
-  // Copy inputs to host. Copy also outputs, cause we might "update" them, rather than overwrite them.
-  for (auto& it : m_zm_fields_in) {
-    it.second.sync_to_host();
-  }
-  for (auto& it : m_zm_fields_out) {
-    it.second.sync_to_host();
+  // Scalar arguments are stored in the first entry of their field
+  auto get_scalar = [&](const std::string& name) -> Real {
+    const auto first = std::make_pair(0,1);
+    Kokkos::deep_copy(Kokkos::subview(m_zm_host_views_out.at(name),first),
+                      Kokkos::subview(m_zm_dev_views_out.at(name),first));
+    return m_zm_host_views_out.at(name)(0);
+  };
+  const Real delt  = get_scalar("delt");
+  const Real ztodt = get_scalar("ztodt");
+  const Real ncnst = get_scalar("ncnst");
+
+  // While Fortran processes batch ib, batch ib+1 is copied to host, and batch ib-1 back
+  // to device. The fence at the top of each iteration guarantees that batch ib is on host,
+  // and that the slot of batch ib-2 (reused by batch ib+1) has been copied back to device.
+  // Note: copy also outputs to host, cause we might "update" them, rather than overwrite them.
+  const int num_batches = (m_num_cols+m_batch_size-1)/m_batch_size;
+  gather_batch(0);
+  for (int ib=0; ib<num_batches; ++ib) {
+    m_copy_space.fence();
+    if (ib>0) {
+      scatter_batch(ib-1);
+    }
+    if (ib+1<num_batches) {
+      gather_batch(ib+1);
+    }
+
+    run_zm_f90(ib,delt,ztodt,ncnst);
   }
+  m_copy_space.fence();
+  scatter_batch(num_batches-1);
+  m_copy_space.fence();
 
-  Real** temp = &m_raw_ptrs_out["fracis"];
-  Real*** fracis = &temp;
-
-  zm_main_f90(*m_raw_ptrs_out["lchnk"], *m_raw_ptrs_out["ncol"], m_raw_ptrs_out["t"],
-  	      m_raw_ptrs_out["qh"], m_raw_ptrs_out["prec"], m_raw_ptrs_out["jctop"],
-              m_raw_ptrs_out["jcbot"], m_raw_ptrs_out["pblh"], m_raw_ptrs_out["zm"],
-              m_raw_ptrs_out["geos"], m_raw_ptrs_out["zi"], m_raw_ptrs_out["qtnd"],
-              m_raw_ptrs_out["heat"], m_raw_ptrs_out["pap"], m_raw_ptrs_out["paph"],
-              m_raw_ptrs_out["dpp"], *m_raw_ptrs_out["delt"], m_raw_ptrs_out["mcon"],
-	      m_raw_ptrs_out["cme"], m_raw_ptrs_out["cape"], m_raw_ptrs_out["tpert"],
-              m_raw_ptrs_out["dlf"], m_raw_ptrs_out["plfx"], m_raw_ptrs_out["zdu"],
-	      m_raw_ptrs_out["rprd"], m_raw_ptrs_out["mu"], m_raw_ptrs_out["md"],
-              m_raw_ptrs_out["du"], m_raw_ptrs_out["eu"], m_raw_ptrs_out["ed"],
-	      m_raw_ptrs_out["dp"], m_raw_ptrs_out["dsubcld"], m_raw_ptrs_out["jt"],
-	      m_raw_ptrs_out["maxg"], m_raw_ptrs_out["ideep"], *m_raw_ptrs_out["lengath"],
-              m_raw_ptrs_out["ql"], m_raw_ptrs_out["rliq"], m_raw_ptrs_out["landfrac"],
-              m_raw_ptrs_out["hu_nm1"], m_raw_ptrs_out["cnv_nm1"], m_raw_ptrs_out["tm1"],
-              m_raw_ptrs_out["qm1"], &m_raw_ptrs_out["t_star"], &m_raw_ptrs_out["q_star"],
-              m_raw_ptrs_out["dcape"], m_raw_ptrs_out["qv"], &m_raw_ptrs_out["tend_s"],
-              &m_raw_ptrs_out["tend_q"], &m_raw_ptrs_out["cld"], m_raw_ptrs_out["snow"],
-              m_raw_ptrs_out["ntprprd"], m_raw_ptrs_out["ntsnprd"],
-              &m_raw_ptrs_out["flxprec"], &m_raw_ptrs_out["flxsnow"],
-              *m_raw_ptrs_out["ztodt"], m_raw_ptrs_out["pguall"], m_raw_ptrs_out["pgdall"],
-              m_raw_ptrs_out["icwu"], *m_raw_ptrs_out["ncnst"], fracis);
   auto ts = timestamp();
   ts += dt;
   for (auto& it : m_zm_fields_out) {
@@ -115,6 +136,105 @@ void ZMDeepConvection::run_impl (const double dt)
   }
 }
 // =========================================================================================
+void ZMDeepConvection::gather_batch (const int ib)
+{
+  using RangePolicy = Kokkos::RangePolicy<DefaultDevice::execution_space>;
+
+  const int slot    = ib % num_batch_slots;
+  const int col_beg = ib*m_batch_size;
+  const int ncol    = std::min(col_beg+m_batch_size,m_num_cols) - col_beg;
+  const int pcols   = m_pcols;
+  for (const auto& it : m_zm_dev_views_out) {
+    const int n = m_col_sizes.at(it.first);
+    const auto f = it.second;
+    const auto b = Kokkos::subview(m_batch_dev_views.at(it.first),slot,Kokkos::ALL());
+
+    // Fortran expects the column index to run fastest
+    Kokkos::parallel_for("ZM::gather_batch",RangePolicy(m_copy_space,0,ncol*n),
+                         KOKKOS_LAMBDA(const int idx) {
+      const int icol = idx / n;
+      const int k    = idx % n;
+      b(k*pcols+icol) = f((col_beg+icol)*n+k);
+    });
+    Kokkos::deep_copy(m_copy_space,
+                      Kokkos::subview(m_batch_host_views.at(it.first),slot,Kokkos::ALL()),b);
+  }
+}
+// =========================================================================================
+void ZMDeepConvection::scatter_batch (const int ib)
+{
+  using RangePolicy = Kokkos::RangePolicy<DefaultDevice::execution_space>;
+
+  const int slot    = ib % num_batch_slots;
+  const int col_beg = ib*m_batch_size;
+  const int ncol    = std::min(col_beg+m_batch_size,m_num_cols) - col_beg;
+  const int pcols   = m_pcols;
+  for (const auto& it : m_zm_dev_views_out) {
+    const int n = m_col_sizes.at(it.first);
+    const auto f = it.second;
+    const auto b = Kokkos::subview(m_batch_dev_views.at(it.first),slot,Kokkos::ALL());
+
+    Kokkos::deep_copy(m_copy_space,b,
+                      Kokkos::subview(m_batch_host_views.at(it.first),slot,Kokkos::ALL()));
+    Kokkos::parallel_for("ZM::scatter_batch",RangePolicy(m_copy_space,0,ncol*n),
+                         KOKKOS_LAMBDA(const int idx) {
+      const int icol = idx / n;
+      const int k    = idx % n;
+      f((col_beg+icol)*n+k) = b(k*pcols+icol);
+    });
+  }
+}
+// =========================================================================================
+void ZMDeepConvection::run_zm_f90 (const int ib, const Real delt, const Real ztodt, const Real ncnst)
+{
+  // Pointer to the buffer of this batch
+  const int slot = ib % num_batch_slots;
+  auto ptr = [&](const std::string& name) -> Real* {
+    return &m_batch_host_views.at(name)(slot,0);
+  };
+
+  // Each batch plays the role of a chunk in EAM
+  const int col_beg = ib*m_batch_size;
+  const Real lchnk = ib;
+  const Real ncol  = std::min(col_beg+m_batch_size,m_num_cols) - col_beg;
+
+  // Number of gathered deep convection columns in this batch (output)
+  Real lengath = 0;
+
+  Real* t_star  = ptr("t_star");
+  Real* q_star  = ptr("q_star");
+  Real* tend_s  = ptr("tend_s");
+  Real* tend_q  = ptr("tend_q");
+  Real* cld     = ptr("cld");
+  Real* flxprec = ptr("flxprec");
+  Real* flxsnow = ptr("flxsnow");
+  Real* temp    = ptr("fracis");
+  Real** temp_ptr = &temp;
+  Real*** fracis = &temp_ptr;
+
+  zm_main_f90(lchnk, ncol, ptr("t"),
+              ptr("qh"), ptr("prec"), ptr("jctop"),
+              ptr("jcbot"), ptr("pblh"), ptr("zm"),
+              ptr("geos"), ptr("zi"), ptr("qtnd"),
+              ptr("heat"), ptr("pap"), ptr("paph"),
+              ptr("dpp"), delt, ptr("mcon"),
+              ptr("cme"), ptr("cape"), ptr("tpert"),
+              ptr("dlf"), ptr("pflx"), ptr("zdu"),
+              ptr("rprd"), ptr("mu"), ptr("md"),
+              ptr("du"), ptr("eu"), ptr("ed"),
+              ptr("dp"), ptr("dsubcld"), ptr("jt"),
+              ptr("maxg"), ptr("ideep"), lengath,
+              ptr("ql"), ptr("rliq"), ptr("landfrac"),
+              ptr("hu_nm1"), ptr("cnv_nm1"), ptr("tm1"),
+              ptr("qm1"), &t_star, &q_star,
+              ptr("dcape"), ptr("qv"), &tend_s,
+              &tend_q, &cld, ptr("snow"),
+              ptr("ntprprd"), ptr("ntsnprd"),
+              &flxprec, &flxsnow,
+              ztodt, ptr("pguall"), ptr("pgdall"),
+              ptr("icwu"), ncnst, fracis);
+}
+// =========================================================================================
 void ZMDeepConvection::finalize_impl()
 {
   zm_finalize_f90 ();
@@ -157,6 +277,8 @@ void ZMDeepConvection::set_computed_field_impl (const Field<      Real>& f) {
   m_zm_fields_out.emplace(name,f);
   m_zm_host_views_out[name] = f.get_view<Host>();
   m_raw_ptrs_out[name] = m_zm_host_views_out[name].data();
+  m_zm_dev_views_out[name] = f.get_view();
+  m_col_sizes[name] = m_zm_host_views_out[name].extent_int(0) / m_num_cols;
 
   // Add myself as provider for the field
   add_me_as_provider(f);
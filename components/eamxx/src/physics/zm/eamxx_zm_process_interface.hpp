@@ -9,6 +9,18 @@
 namespace scream
 {
 
+// Memory space of the host side of the batch buffers. On GPU builds we use
+// page-locked memory, so that the batch copies run asynchronously w.r.t. the host.
+#if defined(KOKKOS_ENABLE_CUDA)
+using ZMPinnedSpace = Kokkos::CudaHostPinnedSpace;
+#elif defined(KOKKOS_ENABLE_HIP)
+using ZMPinnedSpace = Kokkos::Experimental::HIPHostPinnedSpace;
+#elif defined(KOKKOS_ENABLE_SYCL)
+using ZMPinnedSpace = Kokkos::Experimental::SYCLHostUSMSpace;
+#else
+using ZMPinnedSpace = Kokkos::HostSpace;
+#endif
+
 /*
  * The class responsible to handle the atmosphere deep convection
  *
@@ -44,6 +56,12 @@ public:
   // Note: field_mgrs[grid_name] is the FM on grid $grid_name
   void register_fields (const std::map<std::string,std::shared_ptr<FieldManager<Real>>>& field_mgrs) const;
 
+  // Pack batch ib of all computed fields and copy it to host, or copy it back to device
+  // and unpack it. Both are enqueued on m_copy_space, and are asynchronous w.r.t. the host.
+  // Cuda requires methods enclosing __device__ lambda's to be public
+  void gather_batch  (const int ib);
+  void scatter_batch (const int ib);
+
 protected:
 
   std::map<std::string,const_field_type>  m_zm_fields_in;
@@ -64,6 +82,35 @@ protected:
   std::map<std::string,const Real*>  m_raw_ptrs_in;
   std::map<std::string,Real*>        m_raw_ptrs_out;
 
+  // Device views of the computed fields, and number of entries per column of each field,
+  // used to stream batches of columns between host and device
+  std::map<std::string,view_type<Real>>  m_zm_dev_views_out;
+  std::map<std::string,int>              m_col_sizes;
+
+  // Columns are processed in batches of at most m_batch_size columns (which cannot exceed
+  // the Fortran pcols). The Fortran arrays are column-major with leading dimension pcols,
+  // so each batch is packed (on device) into a contiguous buffer with the column index
+  // running fastest, and copied to pinned host memory. While Fortran processes batch k,
+  // batch k+1 is copied to host, and batch k-1 back to device. Batches are processed
+  // serially, since zm_conv has not been verified to be thread safe.
+  static constexpr int num_batch_slots = 3;
+
+  using batch_dev_view_type  = Kokkos::View<Real**,Kokkos::LayoutRight,DefaultDevice>;
+  using batch_host_view_type = Kokkos::View<Real**,Kokkos::LayoutRight,ZMPinnedSpace>;
+
+  std::map<std::string,batch_dev_view_type>   m_batch_dev_views;
+  std::map<std::string,batch_host_view_type>  m_batch_host_views;
+
+  int m_num_cols;
+  int m_batch_size;
+  int m_pcols;
+
+  // Run the Fortran ZM on the (already gathered) batch ib
+  void run_zm_f90 (const int ib, const Real delt, const Real ztodt, const Real ncnst);
+
+  // Execution space instance for the batch copies (separate from the default instance)
+  DefaultDevice::execution_space  m_copy_space;
+
 }; // class ZMDeepConvection
 
 } // namespace scream
@@ -23,7 +23,7 @@ void zm_main_f90(const Real& lchnk, const Real& ncol, Real* t, Real* qh, Real* p
 			Real* mcon, Real* cme, Real* cape, Real* tpert, Real* dlf, Real* plfx,
 			Real* zdu, Real* rprd, Real* mu, Real* md, Real* du, Real* eu, 
 			Real* ed, Real* dp, Real* dsubcld, Real* jt, Real* maxg, Real* ideep,
-			const Real& lengath, Real* ql, Real* rliq, Real* landfrac, Real* hu_nm1,
+			Real& lengath, Real* ql, Real* rliq, Real* landfrac, Real* hu_nm1,
 			Real* cnv_nm1, Real* tm1, Real* qm1, Real** t_star, Real** q_star, 
 			Real* dcape, Real* q, Real** tend_s,
 			Real** tend_q, Real** cld, Real* snow, Real* ntprprd, Real* ntsnprd,
@@ -31,6 +31,7 @@ void zm_main_f90(const Real& lchnk, const Real& ncol, Real* t, Real* qh, Real* p
 			Real* icwu, const Real& ncnst, Real*** fracis 
 			); 
 void zm_finalize_f90 ();
+int  zm_get_pcols_f90 ();
 
 } // extern "C"
 
@@ -63,6 +63,11 @@ AtmosphereProcess (const ekat::Comm& comm, const ekat::ParameterList& params)
       m_params.get<bool>("enable_column_conservation_checks", false);
 
   m_internal_diagnostics_level = m_params.get<int>("internal_diagnostics_level", 0);
+
+  // If true, all tendencies are updated with one kernel launch, rather than one per field
+  m_fused_tendencies = m_params.get<bool>("fused_tendencies", false);
+
+  m_debug_fences = m_params.get<bool>("enable_debug_fences", false);
 }
 
 void AtmosphereProcess::initialize (const TimeStamp& t0, const RunType run_type) {
@@ -80,6 +85,19 @@ void AtmosphereProcess::initialize (const TimeStamp& t0, const RunType run_type)
     m_start_of_step_fields[fname] = get_field_out(fname).clone();
   }
 
+  if (m_compute_proc_tendencies && m_fused_tendencies) {
+    for (const auto& it : m_proc_tendencies) {
+      const auto& tname = it.first;
+      const auto& fname = m_tend_to_field.at(tname);
+      const auto& f     = get_field_out(fname);
+      const auto& f_beg = m_start_of_step_fields.at(fname);
+      m_start_of_step_batch.add_pair(f_beg,f);
+      m_tendencies_batch.add_pair(it.second,f_beg);
+    }
+    m_start_of_step_batch.finalize();
+    m_tendencies_batch.finalize();
+  }
+
   if (this->type()!=AtmosphereProcessType::Group) {
     stop_timer (m_timer_prefix + this->name() + "::init");
   }
@@ -494,11 +512,15 @@ void AtmosphereProcess::run_column_conservation_check () const {
 void AtmosphereProcess::init_step_tendencies () {
   if (m_compute_proc_tendencies) {
     start_timer(m_timer_prefix + this->name() + "::compute_tendencies");
-    for (auto& it : m_start_of_step_fields) {
-      const auto& fname = it.first;
-      const auto& f     = get_field_out(fname);
-            auto& f_beg = it.second;
-      f_beg.deep_copy(f);
+    if (m_fused_tendencies) {
+      m_start_of_step_batch.deep_copy();
+    } else {
+      for (auto& it : m_start_of_step_fields) {
+        const auto& fname = it.first;
+        const auto& f     = get_field_out(fname);
+              auto& f_beg = it.second;
+        f_beg.deep_copy(f);
+      }
     }
     stop_timer(m_timer_prefix + this->name() + "::compute_tendencies");
   }
@@ -509,17 +531,23 @@ void AtmosphereProcess::compute_step_tendencies (const double dt) {
   if (m_compute_proc_tendencies) {
     m_atm_logger->debug("[" + this->name() + "] computing tendencies...");
     start_timer(m_timer_prefix + this->name() + "::compute_tendencies");
-    for (auto it : m_proc_tendencies) {
-      // Note: f_beg is nonconst, so we can store step tendency in it
-      const auto& tname = it.first;
-      const auto& fname = m_tend_to_field.at(tname);
-      const auto& f     = get_field_out(fname);
-            auto& f_beg = m_start_of_step_fields.at(fname);
-            auto& tend  = it.second;
-
-      // Compute tend from this atm proc step, then sum into overall atm timestep tendency
-      f_beg.update(f,1,-1);
-      tend.update(f_beg,1,1);
+    if (m_fused_tendencies) {
+      // Same as below, but with a single kernel launch for all fields at each stage
+      m_start_of_step_batch.update(1,-1);
+      m_tendencies_batch.update(1,1);
+    } else {
+      for (auto it : m_proc_tendencies) {
+        // Note: f_beg is nonconst, so we can store step tendency in it
+        const auto& tname = it.first;
+        const auto& fname = m_tend_to_field.at(tname);
+        const auto& f     = get_field_out(fname);
+              auto& f_beg = m_start_of_step_fields.at(fname);
+              auto& tend  = it.second;
+
+        // Compute tend from this atm proc step, then sum into overall atm timestep tendency
+        f_beg.update(f,1,-1);
+        tend.update(f_beg,1,1);
+      }
     }
     stop_timer(m_timer_prefix + this->name() + "::compute_tendencies");
   }
@@ -10,6 +10,7 @@
 #include "share/field/field_request.hpp"
 #include "share/field/field.hpp"
 #include "share/field/field_group.hpp"
+#include "share/field/field_batch.hpp"
 #include "share/grid/grids_manager.hpp"
 
 #include "ekat/mpi/ekat_comm.hpp"
@@ -287,6 +288,16 @@ protected:
 
   int get_internal_diagnostics_level () const { return m_internal_diagnostics_level; }
 
+  // Processes should enqueue their kernels asynchronously on the default execution
+  // space, and fence only where the host needs the results. Where a fence is not
+  // needed for correctness, they can call this method instead, which only fences
+  // if enable_debug_fences=true, to help localize errors in device kernels.
+  void debug_fence () const {
+    if (m_debug_fences) {
+      Kokkos::fence();
+    }
+  }
+
   // Derived classes can used these method, so that if we change how fields/groups
   // requirement are stored (e.g., change the std container), they don't need to change
   // their implementation.
@@ -521,6 +532,11 @@ private:
   strmap_t<Field>          m_proc_tendencies;
   strmap_t<Field>          m_start_of_step_fields;
 
+  // If fused tendencies are requested, these batch the (f_beg,f) and (tend,f_beg)
+  // pairs, so that all tendencies are handled with one kernel launch per stage
+  FieldBatch               m_start_of_step_batch;
+  FieldBatch               m_tendencies_batch;
+
   // These maps help to retrieve a field/group stored in the lists above. E.g.,
   //   auto ptr = m_field_in_pointers[field_name][grid_name];
   // then *ptr is a field in m_fields_in, with name $field_name, on grid $grid_name.
@@ -570,6 +586,12 @@ private:
   // Whether this atm proc should compute tendencies for any of its updated fields
   bool m_compute_proc_tendencies = false;
 
+  // Whether tendencies of all updated fields are computed in a single batched kernel
+  bool m_fused_tendencies = false;
+
+  // Whether debug_fence() actually fences
+  bool m_debug_fences = false;
+
   // Log level for when property checks perform a repair
   ekat::logger::LogLevel  m_repair_log_level;
 
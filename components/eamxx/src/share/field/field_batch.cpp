@@ -0,0 +1,191 @@
+#include "share/field/field_batch.hpp"
+
+#include "share/util/scream_universal_constants.hpp"
+
+#include <limits>
+
+namespace scream {
+
+void FieldBatch::
+add_pair (const Field& y, const Field& x)
+{
+  EKAT_REQUIRE_MSG (not m_finalized,
+      "Error! Cannot add pairs to a FieldBatch after finalize was called.\n"
+      " - y name: " + y.name() + "\n"
+      " - x name: " + x.name() + "\n");
+  EKAT_REQUIRE_MSG (y.is_allocated() and x.is_allocated(),
+      "Error! Cannot add pair to FieldBatch, since fields are not allocated.\n"
+      " - y name: " + y.name() + "\n"
+      " - x name: " + x.name() + "\n");
+  EKAT_REQUIRE_MSG (not y.is_read_only(),
+      "Error! Cannot add pair to FieldBatch, since y is read-only.\n"
+      " - y name: " + y.name() + "\n");
+  EKAT_REQUIRE_MSG (y.data_type()==get_data_type<Real>() and
+                    x.data_type()==get_data_type<Real>(),
+      "Error! FieldBatch only supports fields with Real data type.\n"
+      " - y name: " + y.name() + "\n"
+      " - x name: " + x.name() + "\n");
+
+  const auto& y_l = y.get_header().get_identifier().get_layout();
+  const auto& x_l = x.get_header().get_identifier().get_layout();
+  EKAT_REQUIRE_MSG (y_l==x_l,
+      "Error! Incompatible layouts for FieldBatch pair.\n"
+      " - x name: " + x.name() + "\n"
+      " - y name: " + y.name() + "\n"
+      " - x layout: " + to_string(x_l) + "\n"
+      " - y layout: " + to_string(y_l) + "\n");
+
+  m_y.push_back(y);
+  m_x.push_back(x);
+}
+
+void FieldBatch::finalize ()
+{
+  EKAT_REQUIRE_MSG (not m_finalized,
+      "Error! FieldBatch::finalize was already called.\n");
+
+  std::vector<Entry> entries;
+  m_batch_size = 0;
+  for (int i=0; i<size(); ++i) {
+    const auto& y = m_y[i];
+    const auto& x = m_x[i];
+
+    const Real* y_data;
+    const Real* x_data;
+    Entry e;
+    if (not get_strided_desc(y,y_data,e.y_offset,e.y_stride) or
+        not get_strided_desc(x,x_data,e.x_offset,e.x_stride)) {
+      m_fallback.push_back(i);
+      continue;
+    }
+
+    const auto& layout = y.get_header().get_identifier().get_layout();
+    const long long sz = layout.size();
+    if (sz==0) {
+      continue;
+    }
+    EKAT_REQUIRE_MSG (m_batch_size + sz <= std::numeric_limits<int>::max(),
+        "Error! FieldBatch total size exceeds the int range.\n");
+
+    e.y = y.get_internal_view_data<Real>();
+    e.x = x_data;
+    e.ninner = layout.rank()>0 ? layout.dims().back() : 1;
+    e.start = m_batch_size;
+
+    // Same fill value logic as in Field::update
+    e.fill_val = constants::DefaultFillValue<Real>().value;
+    if (x.get_header().has_extra_data("mask_value")) {
+      e.fill_val = x.get_header().get_extra_data<float>("mask_value");
+    }
+
+    entries.push_back(e);
+    m_batch_size += sz;
+  }
+
+  m_num_batched = entries.size();
+  m_entries = entries_view("FieldBatch::entries",m_num_batched);
+  auto entries_h = Kokkos::create_mirror_view(m_entries);
+  for (int i=0; i<m_num_batched; ++i) {
+    entries_h(i) = entries[i];
+  }
+  Kokkos::deep_copy(m_entries,entries_h);
+
+  m_finalized = true;
+}
+
+void FieldBatch::update (const Real alpha, const Real beta)
+{
+  EKAT_REQUIRE_MSG (m_finalized,
+      "Error! FieldBatch::update called before finalize.\n");
+
+  run_batched<CombineMode::ScaleUpdate>(alpha,beta);
+  for (int i : m_fallback) {
+    m_y[i].update(m_x[i],alpha,beta);
+  }
+}
+
+void FieldBatch::deep_copy ()
+{
+  EKAT_REQUIRE_MSG (m_finalized,
+      "Error! FieldBatch::deep_copy called before finalize.\n");
+
+  run_batched<CombineMode::Replace>(1,0);
+  for (int i : m_fallback) {
+    m_y[i].deep_copy(m_x[i]);
+  }
+}
+
+bool FieldBatch::
+get_strided_desc (const Field& f, const Real*& data,
+                  int& offset, int& stride) const
+{
+  const auto& fh = f.get_header();
+  const auto& ap = fh.get_alloc_properties();
+  const auto& layout = fh.get_identifier().get_layout();
+
+  data = f.get_internal_view_data_unsafe<const Real>();
+  if (not ap.is_subfield()) {
+    // Non-subfields are always contiguous, possibly with padding
+    // at the end of each "row" of the last dimension.
+    offset = 0;
+    stride = ap.get_last_extent();
+    return ap.contiguous();
+  }
+
+  // We can only handle f = p(...,k,:), with p contiguous and not a subfield itself.
+  const auto& info = ap.get_subview_info();
+  const auto parent = fh.get_parent().lock();
+  if (info.dynamic or not parent) {
+    return false;
+  }
+  const auto& p_ap = parent->get_alloc_properties();
+  const int p_rank = parent->get_identifier().get_layout().rank();
+  if (p_ap.is_subfield() or not p_ap.contiguous() or
+      p_rank<2 or info.dim_idx!=p_rank-2 or layout.rank()!=p_rank-1) {
+    return false;
+  }
+
+  // The internal data of a subfield is the one of the parent.
+  const int last_ext = p_ap.get_last_extent();
+  offset = info.slice_idx*last_ext;
+  stride = info.dim_extent*last_ext;
+  return true;
+}
+
+template<CombineMode CM>
+void FieldBatch::run_batched (const Real alpha, const Real beta)
+{
+  if (m_num_batched==0) {
+    return;
+  }
+
+  using exec_space = typename DefaultDevice::execution_space;
+  using RangePolicy = Kokkos::RangePolicy<exec_space>;
+
+  const auto entries = m_entries;
+  const int nentries = m_num_batched;
+  auto policy = RangePolicy(0,m_batch_size);
+  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const int idx) {
+    // Find the last entry starting at or before idx. The number of
+    // entries is small, so a bisection is cheap.
+    int beg = 0, end = nentries-1;
+    while (beg<end) {
+      const int mid = (beg+end+1)/2;
+      if (entries(mid).start<=idx) {
+        beg = mid;
+      } else {
+        end = mid-1;
+      }
+    }
+    const auto& e = entries(beg);
+    const int loc = idx - e.start;
+    const int i = loc / e.ninner;
+    const int j = loc % e.ninner;
+    combine_and_fill<CM>(e.x[e.x_offset + i*e.x_stride + j],
+                         e.y[e.y_offset + i*e.y_stride + j],
+                         e.fill_val,alpha,beta);
+  });
+  Kokkos::fence();
+}
+
+} // namespace scream
@@ -0,0 +1,97 @@
+#ifndef SCREAM_FIELD_BATCH_HPP
+#define SCREAM_FIELD_BATCH_HPP
+
+#include "share/field/field.hpp"
+#include "share/scream_types.hpp"
+
+#include <vector>
+
+namespace scream {
+
+/*
+ * A FieldBatch stores a list of (y,x) pairs of Real fields, and allows
+ * to perform the same elementwise operation on all pairs with a single
+ * kernel launch (and a single fence), rather than one per pair.
+ *
+ * This is mostly useful for small fields (e.g., tendencies bookkeeping
+ * at low resolution), where the cost of Field::update is dominated by
+ * the launch/fence overhead rather than by the actual work.
+ *
+ * Internally, each field is described as a (possibly strided) 2d array,
+ * where the inner (contiguous) dimension is the last field dimension.
+ * This covers all contiguous fields (padded or not), as well as static
+ * subfields obtained slicing the second-to-last dimension of a contiguous
+ * parent (e.g., a tracer extracted from the tracers group).
+ * Pairs containing a field that does not fit this description can still
+ * be added, but they will be processed one at a time via Field methods.
+ *
+ * Usage: add all pairs, call finalize, then call update/deep_copy
+ * as many times as needed. The x/y fields must not be reallocated
+ * (or have their subview slice changed) after finalize is called.
+ */
+
+class FieldBatch {
+public:
+  FieldBatch () = default;
+
+  // Add a pair of fields. Must be called before finalize.
+  void add_pair (const Field& y, const Field& x);
+
+  // Setup the device data structures needed by update/deep_copy
+  void finalize ();
+
+  // For each pair, computes y = beta*y + alpha*x, with the same
+  // treatment of fill values as Field::update.
+  void update (const Real alpha, const Real beta);
+
+  // For each pair, copies x into y
+  void deep_copy ();
+
+  int size () const { return m_y.size(); }
+  int num_batched () const { return m_num_batched; }
+  bool is_finalized () const { return m_finalized; }
+
+  // Describes a field as a 2d strided array of Real. Must be public,
+  // since it is used inside device lambdas.
+  struct Entry {
+    Real*        y;
+    const Real*  x;
+    int y_offset, y_stride;
+    int x_offset, x_stride;
+    int ninner;
+    int start;    // Index of first element of this entry in the batch
+    Real fill_val;
+  };
+
+#ifndef KOKKOS_ENABLE_CUDA
+  // Cuda requires methods enclosing __device__ lambda's to be public
+protected:
+#endif
+
+  template<CombineMode CM>
+  void run_batched (const Real alpha, const Real beta);
+
+protected:
+
+  // Whether f can be described by an Entry. If so, sets data/offset/stride
+  bool get_strided_desc (const Field& f, const Real*& data,
+                         int& offset, int& stride) const;
+
+  using entries_view = typename KokkosTypes<DefaultDevice>::template view_1d<Entry>;
+
+  std::vector<Field>  m_y;
+  std::vector<Field>  m_x;
+
+  // Pairs processed one at a time
+  std::vector<int>    m_fallback;
+
+  entries_view        m_entries;
+  int                 m_num_batched = 0;
+  int                 m_batch_size  = 0;
+
+  bool                m_finalized = false;
+};
+
+} // namespace scream
+
+#endif // SCREAM_FIELD_BATCH_HPP
@@ -1,8 +1,29 @@
 #include "share/grid/remap/horizontal_remap_utility.hpp"
 #include "share/util/scream_timing.hpp"
 
+#include "ekat/kokkos/ekat_kokkos_utils.hpp"
+
 namespace scream {
 
+namespace {
+// Describe a view as a RemapField, flattening all the non-column dimensions
+template<typename SrcView, typename TgtView>
+HorizontalMap::RemapField make_remap_field (const SrcView& src, const TgtView& tgt)
+{
+  static_assert(SrcView::rank==TgtView::rank, "Error! Source and target views must have the same rank.\n");
+  EKAT_REQUIRE_MSG(src.span_is_contiguous() && tgt.span_is_contiguous(),
+      "Error! HorizontalMap::apply_remap requires contiguous source and target views.\n");
+  const int rank = SrcView::rank;
+  int inner = 1;
+  for (int n=1; n<rank; n++) {
+    EKAT_REQUIRE_MSG(src.extent_int(n)==tgt.extent_int(n),
+        "Error! HorizontalMap::apply_remap requires source and target views with the same non-column extents.\n");
+    inner *= src.extent_int(n);
+  }
+  return HorizontalMap::RemapField{src.data(),tgt.data(),inner};
+}
+} // anonymous namespace
+
 /*-----------------------------------------------------------------------------------------------*/
 HorizontalMap::HorizontalMap(const ekat::Comm& comm)
   : m_comm (comm)
@@ -253,6 +274,7 @@ void HorizontalMap::add_remap_segment(const HorizontalMapSegment& seg)
   }
 
   m_num_segments = m_map_segments.size();
+  m_csr_set = false;
   if (m_unique_set) {
     // We need to reset the unique set of source columns taking
     // into account the new segment.
@@ -339,6 +361,8 @@ void HorizontalMap::set_unique_source_dofs()
     // Sync to Host
     seg.sync_to_host();
   }
+  // Now that all segments are complete, flatten them for use in apply_remap
+  build_csr();
   stop_timer("EAMxx::HorizontalMap::set_unique_dofs");
 }
 /*-----------------------------------------------------------------------------------------------*/
@@ -385,27 +409,68 @@ void HorizontalMap::print() const
     printf("\n=============================================\n");
 }
 /*-----------------------------------------------------------------------------------------------*/
+// This function flattens the segments into a CSR representation on device, with one row per local
+// target dof. Target dofs without a segment get an empty row, so that they are remapped to zero.
+// Note: the column indices are w.r.t. the set of unique source dofs, so this must be called after
+//       the source idx of each segment has been set (see set_unique_source_dofs).
+void HorizontalMap::build_csr()
+{
+  start_timer("EAMxx::HorizontalMap::build_csr");
+  std::vector<int> row_len(m_num_dofs,0);
+  std::vector<const HorizontalMapSegment*> row_seg(m_num_dofs,nullptr);
+  for (const auto& seg : m_map_segments) {
+    const int irow = seg.get_dof_idx();
+    EKAT_REQUIRE_MSG(irow>=0 && irow<m_num_dofs,
+        "Error in HorizontalMap " + m_name + " - segment for dof " + std::to_string(seg.get_dof()) + " has an invalid dof idx.");
+    row_len[irow] = seg.get_length();
+    row_seg[irow] = &seg;
+  }
+
+  m_csr_row_ptr = view_1d<int>("",m_num_dofs+1);
+  auto row_ptr_h = Kokkos::create_mirror_view(m_csr_row_ptr);
+  row_ptr_h(0) = 0;
+  for (int ii=0; ii<m_num_dofs; ii++) {
+    row_ptr_h(ii+1) = row_ptr_h(ii) + row_len[ii];
+  }
+  const int nnz = row_ptr_h(m_num_dofs);
+
+  m_csr_col_idx = view_1d<int>("",nnz);
+  m_csr_weights = view_1d<Real>("",nnz);
+  auto col_idx_h = Kokkos::create_mirror_view(m_csr_col_idx);
+  auto weights_h = Kokkos::create_mirror_view(m_csr_weights);
+  for (int ii=0; ii<m_num_dofs; ii++) {
+    if (row_seg[ii]==nullptr) { continue; }
+    const auto source_idx_h = row_seg[ii]->get_source_idx_on_host();
+    const auto seg_wgts_h   = row_seg[ii]->get_weights_on_host();
+    for (int jj=0; jj<row_len[ii]; jj++) {
+      col_idx_h(row_ptr_h(ii)+jj) = source_idx_h(jj);
+      weights_h(row_ptr_h(ii)+jj) = seg_wgts_h(jj);
+    }
+  }
+  Kokkos::deep_copy(m_csr_row_ptr,row_ptr_h);
+  Kokkos::deep_copy(m_csr_col_idx,col_idx_h);
+  Kokkos::deep_copy(m_csr_weights,weights_h);
+  m_csr_set = true;
+  stop_timer("EAMxx::HorizontalMap::build_csr");
+}
+/*-----------------------------------------------------------------------------------------------*/
 // This overload of apply remap assumes a single horizontal slice of source data being mapped onto
 // a horizontal slice of remapped data.  The assumption is that there are no levels in this data.
 void HorizontalMap::apply_remap(const view_1d<const Real>& source_data, const view_1d<Real>& remapped_data) {
-  start_timer("EAMxx::HorizontalMap::apply_remap_1d");
   if (m_num_dofs==0) { return; } // This HorizontalMap has nothing to do for this rank.
-  auto remapped_data_h = Kokkos::create_mirror_view(remapped_data);
-  auto source_data_h = Kokkos::create_mirror_view(source_data);
-  Kokkos::deep_copy(source_data_h,source_data);
-  Kokkos::deep_copy(remapped_data_h,0.0);
-  for (int iseg=0; iseg<m_num_segments; iseg++) {
-    auto seg = m_map_segments[iseg];
-    auto seg_dof_idx  = seg.get_dof_idx();
-    auto seg_length   = seg.get_length();
-    auto source_idx_h = seg.get_source_idx_on_host();
-    auto weights_h    = seg.get_weights_on_host();
-    for (int ii=0; ii<seg_length; ii++) {
-      int idx = source_idx_h(ii);
-      remapped_data_h(seg_dof_idx) += source_data_h(idx)*weights_h(ii);
+  start_timer("EAMxx::HorizontalMap::apply_remap_1d");
+  EKAT_REQUIRE_MSG(m_csr_set,"Error in HorizontalMap " + m_name + " - apply_remap called before set_unique_source_dofs.");
+  const auto row_ptr = m_csr_row_ptr;
+  const auto col_idx = m_csr_col_idx;
+  const auto weights = m_csr_weights;
+  Kokkos::parallel_for("HorizontalMap::apply_remap_1d", m_num_dofs, KOKKOS_LAMBDA (const int& irow) {
+    Real accum = 0;
+    for (int jj=row_ptr(irow); jj<row_ptr(irow+1); jj++) {
+      accum += weights(jj)*source_data(col_idx(jj));
     }
-  }
-  Kokkos::deep_copy(remapped_data,remapped_data_h);
+    remapped_data(irow) = accum;
+  });
+  Kokkos::fence();
   stop_timer("EAMxx::HorizontalMap::apply_remap_1d");
 }
 /*-----------------------------------------------------------------------------------------------*/
@@ -413,27 +478,9 @@ void HorizontalMap::apply_remap(const view_1d<const Real>& source_data, const vi
 // a set horizontal slices of remapped data.  The assumption is that the second dimension is number
 // of levels
 void HorizontalMap::apply_remap(const view_2d<const Real>& source_data, const view_2d<Real>& remapped_data) {
-  start_timer("EAMxx::HorizontalMap::apply_remap_2d");
   if (m_num_dofs==0) { return; } // This HorizontalMap has nothing to do for this rank.
-  int num_levs = source_data.extent(1);
-  auto remapped_data_h = Kokkos::create_mirror_view(remapped_data);
-  auto source_data_h = Kokkos::create_mirror_view(source_data);
-  Kokkos::deep_copy(source_data_h,source_data);
-  Kokkos::deep_copy(remapped_data_h,0.0);
-  for (int iseg=0; iseg<m_num_segments; iseg++) {
-    auto seg = m_map_segments[iseg];
-    auto seg_dof_idx  = seg.get_dof_idx();
-    auto seg_length   = seg.get_length();
-    auto source_idx_h = seg.get_source_idx_on_host();
-    auto weights_h    = seg.get_weights_on_host();
-    for (int ii=0; ii<seg_length; ii++) {
-      for (int kk=0; kk<num_levs; kk++) {
-        int idx = source_idx_h(ii);
-        remapped_data_h(seg_dof_idx,kk) += source_data_h(idx,kk)*weights_h(ii);
-      }
-    }
-  }
-  Kokkos::deep_copy(remapped_data,remapped_data_h);
+  start_timer("EAMxx::HorizontalMap::apply_remap_2d");
+  apply_remap_impl({make_remap_field(source_data,remapped_data)});
   stop_timer("EAMxx::HorizontalMap::apply_remap_2d");
 }
 /*-----------------------------------------------------------------------------------------------*/
@@ -441,31 +488,78 @@ void HorizontalMap::apply_remap(const view_2d<const Real>& source_data, const vi
 // a set of horizontal slices of remapped data.  The assumption is that there are levels and one other
 // dimension for this data.
 void HorizontalMap::apply_remap(const view_3d<const Real>& source_data, const view_3d<Real>& remapped_data) {
+  if (m_num_dofs==0) { return; } // This HorizontalMap has nothing to do for this rank.
   start_timer("EAMxx::HorizontalMap::apply_remap_3d");
+  apply_remap_impl({make_remap_field(source_data,remapped_data)});
+  stop_timer("EAMxx::HorizontalMap::apply_remap_3d");
+}
+/*-----------------------------------------------------------------------------------------------*/
+void HorizontalMap::apply_remap(const std::vector<view_2d<const Real>>& source_data, const std::vector<view_2d<Real>>& remapped_data) {
   if (m_num_dofs==0) { return; } // This HorizontalMap has nothing to do for this rank.
-  int num_levs = source_data.extent(2);
-  int num_bands = source_data.extent(1);
-  auto remapped_data_h = Kokkos::create_mirror_view(remapped_data);
-  auto source_data_h = Kokkos::create_mirror_view(source_data);
-  Kokkos::deep_copy(source_data_h,source_data);
-  Kokkos::deep_copy(remapped_data_h,0.0);
-  for (int iseg=0; iseg<m_num_segments; iseg++) {
-    auto seg = m_map_segments[iseg];
-    auto seg_dof_idx  = seg.get_dof_idx();
-    auto seg_length   = seg.get_length();
-    auto source_idx_h = seg.get_source_idx_on_host();
-    auto weights_h    = seg.get_weights_on_host();
-    for (int ii=0; ii<seg_length; ii++) {
-      for (int nn=0; nn<num_bands; nn++) {
-        for (int kk=0; kk<num_levs; kk++) {
-          int idx = source_idx_h(ii);
-          remapped_data_h(seg_dof_idx,nn,kk) += source_data_h(idx,nn,kk)*weights_h(ii);
-        }
-      }
-    }
+  start_timer("EAMxx::HorizontalMap::apply_remap_2d_batched");
+  EKAT_REQUIRE_MSG(source_data.size()==remapped_data.size(),
+      "Error in HorizontalMap " + m_name + " - number of source and remapped fields do not match.");
+  std::vector<RemapField> fields;
+  for (size_t ii=0; ii<source_data.size(); ii++) {
+    fields.push_back(make_remap_field(source_data[ii],remapped_data[ii]));
   }
-  Kokkos::deep_copy(remapped_data,remapped_data_h);
-  stop_timer("EAMxx::HorizontalMap::apply_remap_3d");
+  apply_remap_impl(fields);
+  stop_timer("EAMxx::HorizontalMap::apply_remap_2d_batched");
+}
+/*-----------------------------------------------------------------------------------------------*/
+void HorizontalMap::apply_remap(const std::vector<view_3d<const Real>>& source_data, const std::vector<view_3d<Real>>& remapped_data) {
+  if (m_num_dofs==0) { return; } // This HorizontalMap has nothing to do for this rank.
+  start_timer("EAMxx::HorizontalMap::apply_remap_3d_batched");
+  EKAT_REQUIRE_MSG(source_data.size()==remapped_data.size(),
+      "Error in HorizontalMap " + m_name + " - number of source and remapped fields do not match.");
+  std::vector<RemapField> fields;
+  for (size_t ii=0; ii<source_data.size(); ii++) {
+    fields.push_back(make_remap_field(source_data[ii],remapped_data[ii]));
+  }
+  apply_remap_impl(fields);
+  stop_timer("EAMxx::HorizontalMap::apply_remap_3d_batched");
+}
+/*-----------------------------------------------------------------------------------------------*/
+// Remap all fields with a single kernel. Each team handles one (target column, field) pair, and
+// the threads/vector lanes of the team handle the (contiguous) non-column entries of the field.
+void HorizontalMap::apply_remap_impl(const std::vector<RemapField>& fields) {
+  EKAT_REQUIRE_MSG(m_csr_set,"Error in HorizontalMap " + m_name + " - apply_remap called before set_unique_source_dofs.");
+  const int num_fields = fields.size();
+  if (num_fields==0) { return; }
+
+  using RemapFieldView = view_1d<RemapField>;
+  RemapFieldView fields_d("",num_fields);
+  auto fields_h = Kokkos::create_mirror_view(fields_d);
+  int max_inner = 0;
+  for (int ifld=0; ifld<num_fields; ifld++) {
+    fields_h(ifld) = fields[ifld];
+    max_inner = std::max(max_inner,fields[ifld].inner);
+  }
+  Kokkos::deep_copy(fields_d,fields_h);
+
+  using ESU = ekat::ExeSpaceUtils<KT::ExeSpace>;
+  using MemberType = KT::MemberType;
+  const auto policy  = ESU::get_default_team_policy(m_num_dofs*num_fields,max_inner);
+  const int num_rows = m_num_dofs;
+  const auto row_ptr = m_csr_row_ptr;
+  const auto col_idx = m_csr_col_idx;
+  const auto weights = m_csr_weights;
+  Kokkos::parallel_for("HorizontalMap::apply_remap", policy, KOKKOS_LAMBDA (const MemberType& team) {
+    const int ifld = team.league_rank() / num_rows;
+    const int irow = team.league_rank() % num_rows;
+    const auto& f  = fields_d(ifld);
+    const int beg  = row_ptr(irow);
+    const int end  = row_ptr(irow+1);
+    Real* tgt = f.tgt + irow*f.inner;
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,f.inner), [&](const int& kk) {
+      Real accum = 0;
+      for (int jj=beg; jj<end; jj++) {
+        accum += weights(jj)*f.src[col_idx(jj)*f.inner+kk];
+      }
+      tgt[kk] = accum;
+    });
+  });
+  Kokkos::fence();
 }
 /*-----------------------------------------------------------------------------------------------*/
 HorizontalMapSegment::HorizontalMapSegment(const gid_type dof_gid, const int length)
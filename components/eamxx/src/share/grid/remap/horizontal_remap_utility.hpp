@@ -7,6 +7,7 @@
 #include "ekat/kokkos/ekat_subview_utils.hpp"
 
 #include <numeric>
+#include <vector>
 
 namespace scream {
 
@@ -84,6 +85,13 @@ private:
  *   N:          Is the total number of source columns mapping to the target column (N>=1)
  *
  * This structure follows the format used by the component coupler.
+ *
+ * Once the unique source dofs are set, the segments are also flattened into a compressed
+ * sparse row (CSR) representation on device, with one row per local target dof:
+ *   Y_target(i) = sum_(j=row_ptr(i))^(row_ptr(i+1)-1) ( weights(j) * Y_source(col_idx(j)) )
+ * where col_idx is the index of the source column in the set of unique source dofs.
+ * The apply_remap functions use this representation, remapping all the levels (and any other
+ * non-column dimension) of a target column within a single team.
  * --------------------------------------
  *  A.S. Donahue (LLNL): 2022-09-07
  *===============================================================================================*/
@@ -116,6 +124,11 @@ public:
   void apply_remap(const view_1d<const Real>& source_data, const view_1d<Real>& remapped_data);
   void apply_remap(const view_2d<const Real>& source_data, const view_2d<Real>& remapped_data);
   void apply_remap(const view_3d<const Real>& source_data, const view_3d<Real>& remapped_data);
+
+  // Batched versions of the above: all the fields are remapped with a single kernel launch.
+  // The fields can have different extents in the non-column dimensions.
+  void apply_remap(const std::vector<view_2d<const Real>>& source_data, const std::vector<view_2d<Real>>& remapped_data);
+  void apply_remap(const std::vector<view_3d<const Real>>& source_data, const std::vector<view_3d<Real>>& remapped_data);
  
   // Helper functions
   void check() const;      // A check to make sure the map is valid
@@ -133,8 +146,28 @@ public:
   int                    get_num_of_dofs() const { return m_num_dofs; }
   std::vector<HorizontalMapSegment> get_map_segments() const { return m_map_segments; }
   int                    get_num_of_segments() const { return m_num_segments; }
-  
+  view_1d<int>           get_csr_row_ptr() const { return m_csr_row_ptr; }
+  view_1d<int>           get_csr_col_idx() const { return m_csr_col_idx; }
+  view_1d<Real>          get_csr_weights() const { return m_csr_weights; }
+
+  // A field to remap, with all the non-column dimensions flattened into a single one.
+  // Must be public, since it is used inside device lambdas.
+  struct RemapField {
+    const Real* src;
+    Real*       tgt;
+    int         inner;  // Product of all non-column extents
+  };
+
+#ifndef KOKKOS_ENABLE_CUDA
+  // Cuda requires methods enclosing __device__ lambda's to be public
 private:
+#endif
+  void apply_remap_impl(const std::vector<RemapField>& fields);
+
+private:
+
+  // Build the CSR representation of the map from the segments
+  void build_csr();
 
   // Global degrees of freedom information on target grid
   view_1d<gid_type> m_dofs_gids;
@@ -149,6 +182,11 @@ private:
   bool                   m_dofs_set = false;
   std::vector<HorizontalMapSegment> m_map_segments;
   int                    m_num_segments = 0;
+  // CSR representation of the map, with one row per local target dof
+  view_1d<int>           m_csr_row_ptr;
+  view_1d<int>           m_csr_col_idx;
+  view_1d<Real>          m_csr_weights;
+  bool                   m_csr_set = false;
 
 }; // struct HorizontalMap
 
@@ -1,7 +1,6 @@
 #include "vertical_remapper.hpp"
 
 #include "share/grid/point_grid.hpp"
-#include "share/util/scream_vertical_interpolation.hpp"
 #include "share/io/scorpio_input.hpp"
 #include "share/field/field_tag.hpp"
 #include "share/field/field_identifier.hpp"
@@ -306,14 +305,38 @@ void VerticalRemapper::do_registration_ends ()
     "Field for vertical profile of the source data for layout LEV has not been set.\n");
   EKAT_REQUIRE_MSG(m_int_set,"Error::VerticalRemapper:registration_ends,\n"
     "Field for vertical profile of the source data for layout ILEV has not been set.\n");
+
+  // Allocate the brackets of the target levels in the source profiles
+  const int ncols = m_src_grid->get_num_local_dofs();
+  for (auto bracket : {&m_mid_bracket, &m_int_bracket}) {
+    bracket->idx = view_2d<int>("vert_remap_bracket_idx",ncols,m_num_remap_levs);
+    bracket->num = view_2d<Real>("vert_remap_bracket_num",ncols,m_num_remap_levs);
+    bracket->den = view_2d<Real>("vert_remap_bracket_den",ncols,m_num_remap_levs);
+  }
 }
 
 void VerticalRemapper::do_remap_fwd ()
 {
   using namespace ShortFieldTagsNames;
+
+  // Bracket the target levels in each source profile that some field needs.
+  // This is done once here, and shared by all fields with the same vertical tag.
+  bool need_mid = false, need_int = false;
+  for (const auto& fields : {&m_src_fields, &m_src_masks}) {
+    for (const auto& f : *fields) {
+      const auto src_tag = f.get_header().get_identifier().get_layout().tags().back();
+      need_mid = need_mid or src_tag==LEV;
+      need_int = need_int or src_tag==ILEV;
+    }
+  }
+  if (need_mid) {
+    compute_vertical_bracket(m_src_mid,m_mid_bracket);
+  }
+  if (need_int) {
+    compute_vertical_bracket(m_src_int,m_int_bracket);
+  }
+
   // Loop over each field
-  constexpr auto can_pack = SCREAM_PACK_SIZE>1;
-  const auto& tgt_pres_ap = m_remap_pres.get_header().get_alloc_properties();
   for (int i=0; i<m_num_fields; ++i) {
     const auto& f_src    = m_src_fields[i];
           auto  f_tgt    = m_tgt_fields[i];
@@ -321,18 +344,7 @@ void VerticalRemapper::do_remap_fwd ()
     const auto  src_tag  = layout.tags().back();
     const bool  do_remap = ekat::contains(std::vector<FieldTag>{ILEV,LEV},src_tag);
     if (do_remap) {
-      // Dispatch kernel with the largest possible pack size
-      const auto& src_ap = f_src.get_header().get_alloc_properties();
-      const auto& tgt_ap = f_tgt.get_header().get_alloc_properties();
-      const auto& src_pres_ap = src_tag == LEV ? m_src_mid.get_header().get_alloc_properties() : m_src_int.get_header().get_alloc_properties();
-      if (can_pack && src_ap.is_compatible<RPack<SCREAM_PACK_SIZE>>() &&
-                      tgt_ap.is_compatible<RPack<SCREAM_PACK_SIZE>>() &&
-                      src_pres_ap.is_compatible<RPack<SCREAM_PACK_SIZE>>() &&
-                      tgt_pres_ap.is_compatible<RPack<SCREAM_PACK_SIZE>>()) {
-        apply_vertical_interpolation<SCREAM_PACK_SIZE>(f_src,f_tgt); 
-      } else {
-        apply_vertical_interpolation<1>(f_src,f_tgt); 
-      }
+      apply_vertical_interpolation(f_src,f_tgt,src_tag==LEV ? m_mid_bracket : m_int_bracket);
     } else {
       // There is nothing to do, this field cannot be vertically interpolated,
       // so just copy it over.  Note, if this field has its own mask data make
@@ -354,68 +366,121 @@ void VerticalRemapper::do_remap_fwd ()
     if (do_remap) {
       // If we are remapping then we need to initialize the mask source values to 1.0
       f_src.deep_copy(1.0);
-      // Dispatch kernel with the largest possible pack size
-      const auto& src_ap = f_src.get_header().get_alloc_properties();
-      const auto& tgt_ap = f_tgt.get_header().get_alloc_properties();
-      const auto& src_pres_ap = src_tag == LEV ? m_src_mid.get_header().get_alloc_properties() : m_src_int.get_header().get_alloc_properties();
-      if (can_pack && src_ap.is_compatible<RPack<SCREAM_PACK_SIZE>>() &&
-                      tgt_ap.is_compatible<RPack<SCREAM_PACK_SIZE>>() &&
-                      src_pres_ap.is_compatible<RPack<SCREAM_PACK_SIZE>>() &&
-                      tgt_pres_ap.is_compatible<RPack<SCREAM_PACK_SIZE>>()) {
-        apply_vertical_interpolation<SCREAM_PACK_SIZE>(f_src,f_tgt,true); 
-      } else {
-        apply_vertical_interpolation<1>(f_src,f_tgt,true); 
-      }
+      apply_vertical_interpolation(f_src,f_tgt,src_tag==LEV ? m_mid_bracket : m_int_bracket,true);
     } else {
       // There is nothing to do, this field cannot be vertically interpolated,
       // so just copy it over.
       f_tgt.deep_copy(f_src);
     }
   }
+  Kokkos::fence();
 }
 
-template<int Packsize>
 void VerticalRemapper::
-apply_vertical_interpolation(const Field& f_src, const Field& f_tgt, const bool mask_interp) const
+compute_vertical_bracket (const Field& src_pres, VerticalBracket& bracket) const
 {
-    
-    using Pack = ekat::Pack<Real,Packsize>;
-    using namespace ShortFieldTagsNames;
-    using namespace scream::vinterp;
-    const auto& layout = f_src.get_header().get_identifier().get_layout();
-    const auto  rank   = f_src.rank();
-    const auto src_tag = layout.tags().back();
-    const auto src_num_levs = layout.dims().back();
-    // ARG mask_interp checks if this is a vertical interpolation of the mask array that tracks masked 0.0 or not 1.0
-    Real mask_val = mask_interp ? 0.0 : m_mask_val;
-
-    Field    src_lev_f;
-    if (src_tag == ILEV) {
-      src_lev_f = m_src_int;
-    } else {
-      src_lev_f = m_src_mid;
+  using RangePolicy = typename KT::RangePolicy;
+
+  const auto& layout = src_pres.get_header().get_identifier().get_layout();
+  const int ncols     = layout.dim(0);
+  const int nlevs_src = layout.dims().back();
+  const int nlevs_tgt = m_num_remap_levs;
+
+  const auto p_src = src_pres.get_view<const Real**>();
+  const auto p_tgt = m_remap_pres.get_view<const Real*>();
+  const auto idx = bracket.idx;
+  const auto num = bracket.num;
+  const auto den = bracket.den;
+  Kokkos::parallel_for(RangePolicy(0,ncols*nlevs_tgt),
+                       KOKKOS_LAMBDA(const int& n) {
+    const int icol = n / nlevs_tgt;
+    const int k    = n % nlevs_tgt;
+    const Real p = p_tgt(k);
+    // Mask out levels above (below) the minimum (maximum) source pressure
+    if (p < p_src(icol,0) || p > p_src(icol,nlevs_src-1)) {
+      idx(icol,k) = -1;
+      return;
     }
-    auto src_lev  = src_lev_f.get_view<const Pack**>();
-    auto remap_pres_view = m_remap_pres.get_view<Pack*>();
-    switch(rank) {
-      case 2:
-      {
-        auto src_view = f_src.get_view<const Pack**>();
-        auto tgt_view = f_tgt.get_view<      Pack**>();
-        perform_vertical_interpolation<Real,Packsize,2>(src_lev,remap_pres_view,src_view,tgt_view,src_num_levs,m_num_remap_levs,mask_val);
-        break;
-      }
-      case 3:
-      {
-        auto src_view = f_src.get_view<const Pack***>();
-        auto tgt_view = f_tgt.get_view<      Pack***>();
-        perform_vertical_interpolation<Real,Packsize,3>(src_lev,remap_pres_view,src_view,tgt_view,src_num_levs,m_num_remap_levs,mask_val);
-        break;
+    // Binary search for the last source level with p_src <= p
+    int lo = 0, hi = nlevs_src-1;
+    while (lo < hi) {
+      const int mid = (lo + hi + 1) / 2;
+      if (p_src(icol,mid) <= p) {
+        lo = mid;
+      } else {
+        hi = mid - 1;
       }
-      default:
-        EKAT_ERROR_MSG ("Error! Field rank (" + std::to_string(rank) + ") not supported by VerticalRemapper.\n");
     }
+    // If p is at the last source level, use the interval ending there
+    const int ilo = lo==nlevs_src-1 ? lo-1 : lo;
+    idx(icol,k) = lo;
+    num(icol,k) = p - p_src(icol,lo);
+    den(icol,k) = p_src(icol,ilo+1) - p_src(icol,ilo);
+  });
+}
 
+void VerticalRemapper::
+apply_vertical_interpolation(const Field& f_src, const Field& f_tgt,
+                             const VerticalBracket& bracket,
+                             const bool mask_interp) const
+{
+  using RangePolicy = typename KT::RangePolicy;
+
+  const auto& layout = f_src.get_header().get_identifier().get_layout();
+  const auto  rank   = f_src.rank();
+  const int nlevs_src = layout.dims().back();
+  const int nlevs_tgt = m_num_remap_levs;
+  const int ncols     = layout.dim(0);
+  // ARG mask_interp checks if this is a vertical interpolation of the mask array that tracks masked 0.0 or not 1.0
+  const Real mask_val = mask_interp ? 0.0 : m_mask_val;
+
+  // Gather the bracketing source values and blend them, in the same form as
+  // ekat::LinInterp: y(idx) + (y(lo+1)-y(lo))*num/den.
+  const auto idx = bracket.idx;
+  const auto num = bracket.num;
+  const auto den = bracket.den;
+  switch(rank) {
+    case 2:
+    {
+      const auto src = f_src.get_view<const Real**>();
+      const auto tgt = f_tgt.get_view<      Real**>();
+      Kokkos::parallel_for(RangePolicy(0,ncols*nlevs_tgt),
+                           KOKKOS_LAMBDA(const int& n) {
+        const int icol = n / nlevs_tgt;
+        const int k    = n % nlevs_tgt;
+        const int i    = idx(icol,k);
+        if (i < 0) {
+          tgt(icol,k) = mask_val;
+          return;
+        }
+        const int lo = i==nlevs_src-1 ? i-1 : i;
+        tgt(icol,k) = src(icol,i) + (src(icol,lo+1)-src(icol,lo))*num(icol,k)/den(icol,k);
+      });
+      break;
+    }
+    case 3:
+    {
+      const int ncmps = layout.dim(1);
+      const auto src = f_src.get_view<const Real***>();
+      const auto tgt = f_tgt.get_view<      Real***>();
+      Kokkos::parallel_for(RangePolicy(0,ncols*ncmps*nlevs_tgt),
+                           KOKKOS_LAMBDA(const int& n) {
+        const int icol = n / (ncmps*nlevs_tgt);
+        const int icmp = (n / nlevs_tgt) % ncmps;
+        const int k    = n % nlevs_tgt;
+        const int i    = idx(icol,k);
+        if (i < 0) {
+          tgt(icol,icmp,k) = mask_val;
+          return;
+        }
+        const int lo = i==nlevs_src-1 ? i-1 : i;
+        tgt(icol,icmp,k) = src(icol,icmp,i) + (src(icol,icmp,lo+1)-src(icol,icmp,lo))*num(icol,k)/den(icol,k);
+      });
+      break;
+    }
+    default:
+      EKAT_ERROR_MSG ("Error! Field rank (" + std::to_string(rank) + ") not supported by VerticalRemapper.\n");
+  }
 }
 
 } // namespace scream
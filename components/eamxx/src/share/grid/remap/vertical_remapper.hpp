@@ -102,26 +102,43 @@ protected:
   void set_pressure_levels (const std::string& map_file);
   void do_print();
 
+  using KT = KokkosTypes<DefaultDevice>;
+  using gid_type = AbstractGrid::gid_type;
+
+  template<typename T>
+  using view_1d = typename KT::template view_1d<T>;
+  template<typename T>
+  using view_2d = typename KT::template view_2d<T>;
+
+  // Position of each target level within a source pressure profile. All fields
+  // sharing the profile are interpolated with the same bracket, so the search
+  // over the source levels is done once per remap, not once per field.
+  // For column i and target level k:
+  //  - idx(i,k) is the last source level with p_src <= p_tgt(k) (clamped to
+  //    [0,nlevs_src-1]), or -1 if p_tgt(k) is outside the source profile, in
+  //    which case the target is masked;
+  //  - num(i,k) = p_tgt(k) - p_src(idx), and den(i,k) is the pressure
+  //    difference of the bracketing source levels.
+  struct VerticalBracket {
+    view_2d<int>  idx;
+    view_2d<Real> num;
+    view_2d<Real> den;
+  };
+
 #ifdef KOKKOS_ENABLE_CUDA
 public:
 #endif
-  template<int N>
-  void apply_vertical_interpolation (const Field& f_src, const Field& f_tgt, const bool mask_interp=false) const;
+  void compute_vertical_bracket (const Field& src_pres, VerticalBracket& bracket) const;
+  void apply_vertical_interpolation (const Field& f_src, const Field& f_tgt,
+                                     const VerticalBracket& bracket,
+                                     const bool mask_interp=false) const;
 protected:
 
-  using KT = KokkosTypes<DefaultDevice>;
-  using gid_type = AbstractGrid::gid_type;
-
   template<int N>
   using RPack = ekat::Pack<Real,N>;
 
   using mPack = RPack<SCREAM_PACK_SIZE>;
 
-  template<typename T>
-  using view_1d = typename KT::template view_1d<T>;
-  template<typename T>
-  using view_2d = typename KT::template view_2d<T>;
-
   ekat::Comm            m_comm;
 
   // Source and target fields
@@ -138,6 +155,11 @@ protected:
   Field                 m_src_int;  // Src vertical profile for ILEV layouts
   bool                  m_mid_set = false;
   bool                  m_int_set = false;
+
+  // Brackets of the target levels in m_src_mid and m_src_int, recomputed at
+  // the start of each remap since the source profiles evolve in time.
+  VerticalBracket       m_mid_bracket;
+  VerticalBracket       m_int_bracket;
 };
 
 } // namespace scream
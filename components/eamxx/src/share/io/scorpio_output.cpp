@@ -132,6 +132,17 @@ AtmosphereOutput (const ekat::Comm& comm, const ekat::ParameterList& params,
   if (params.isParameter("fill_threshold")) {
     m_avg_coeff_threshold = params.get<Real>("fill_threshold");
   }
+  if (params.isParameter("significant_digits")) {
+    m_significant_digits = params.get<int>("significant_digits");
+    constexpr int max_digits = std::numeric_limits<Real>::digits10;
+    EKAT_REQUIRE_MSG (m_significant_digits>=0 && m_significant_digits<=max_digits,
+        "Error! Invalid value for significant_digits.\n"
+        "  - input value: " + std::to_string(m_significant_digits) + "\n"
+        "  - valid range: [0," + std::to_string(max_digits) + "]\n");
+    if (m_significant_digits>0) {
+      m_quantize_bits = nsd_to_mantissa_bits(m_significant_digits);
+    }
+  }
 
   // Figure out what kind of averaging is requested
   auto avg_type = params.get<std::string>("Averaging Type");
@@ -469,6 +480,7 @@ run (const std::string& filename,
     const bool is_diagnostic = (m_diagnostics.find(name) != m_diagnostics.end());
     const bool is_aliasing_field_view =
         m_avg_type==OutputAvgType::Instant &&
+        m_quantize_bits==0 &&
         field.get_header().get_alloc_properties().get_padding()==0 &&
         field.get_header().get_parent().expired() &&
         not is_diagnostic;
@@ -628,6 +640,17 @@ run (const std::string& filename,
           });
         }
       }
+      // Quantize while data is still on device, so that the host copy (and the
+      // PIO write) already sees the rounded values. Only output files are quantized,
+      // since history restart files must contain the exact running tallies.
+      if (output_step and m_quantize_bits>0) {
+        const int keepbits = m_quantize_bits;
+        Kokkos::parallel_for(policy, KOKKOS_LAMBDA(int i) {
+          if (data[i] != fill_value) {
+            data[i] = quantize(data[i],keepbits);
+          }
+        });
+      }
       // Bring data to host
       auto view_host = m_host_views_1d.at(name);
       Kokkos::deep_copy (view_host,view_dev);
@@ -691,7 +714,7 @@ res_dep_memory_footprint () const {
   for (const auto& fn : m_fields_names) {
     bool is_diagnostic = (m_diagnostics.find(fn) != m_diagnostics.end());
     bool can_alias_field_view =
-        m_avg_type==OutputAvgType::Instant && not is_diagnostic &&
+        m_avg_type==OutputAvgType::Instant && not is_diagnostic && m_quantize_bits==0 &&
         io_field_mgr->get_field(fn).get_header().get_alloc_properties().get_padding()==0 &&
         io_field_mgr->get_field(fn).get_header().get_parent().expired();
 
@@ -818,9 +841,10 @@ void AtmosphereOutput::register_views()
     // would be strided).
     //
     // We also don't want to alias to a diagnostic output since it could share memory
-    // with another diagnostic.
+    // with another diagnostic, nor when quantizing output, since that is done in place.
     bool can_alias_field_view =
         m_avg_type==OutputAvgType::Instant &&
+        m_quantize_bits==0 &&
         field.get_header().get_alloc_properties().get_padding()==0 &&
         field.get_header().get_parent().expired() &&
         not is_diagnostic;
@@ -918,7 +942,8 @@ reset_dev_views()
 void AtmosphereOutput::
 register_variables(const std::string& filename,
                    const std::string& fp_precision,
-                   const scorpio::FileMode mode)
+                   const scorpio::FileMode mode,
+                   const bool is_hist_restart_file)
 {
   using namespace scorpio;
   using namespace ShortFieldTagsNames;
@@ -1024,6 +1049,11 @@ register_variables(const std::string& filename,
         set_variable_metadata(filename,name,"averaging_count_tracker",lookup);
       }
 
+      // Record how many significant digits are retained, if data is quantized
+      if (m_quantize_bits>0 && not is_hist_restart_file) {
+        set_variable_metadata(filename,name,"quantization_nsd",std::to_string(m_significant_digits));
+      }
+
       // Atm procs may have set some request for metadata.
       using stratts_t = std::map<std::string,std::string>;
       const auto& str_atts = field.get_header().get_extra_data<stratts_t>("io: string attributes");
@@ -1155,7 +1185,8 @@ void AtmosphereOutput::set_degrees_of_freedom(const std::string& filename)
 void AtmosphereOutput::
 setup_output_file(const std::string& filename,
                   const std::string& fp_precision,
-                  const scorpio::FileMode mode)
+                  const scorpio::FileMode mode,
+                  const bool is_hist_restart_file)
 {
   using namespace scream::scorpio;
 
@@ -1165,7 +1196,7 @@ setup_output_file(const std::string& filename,
   }
 
   // Register variables with netCDF file.  Must come after dimensions are registered.
-  register_variables(filename,fp_precision,mode);
+  register_variables(filename,fp_precision,mode,is_hist_restart_file);
 
   // Set the offsets of the local dofs in the global vector.
   set_degrees_of_freedom(filename);
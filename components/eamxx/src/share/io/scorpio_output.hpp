@@ -28,6 +28,7 @@
  *  filename_prefix:              STRING
  *  Averaging Type:               STRING
  *  Max Snapshots Per File:       INT                   (default: 1)
+ *  significant_digits:           INT                   (default: 0)
  *  Fields:
  *     GRID_NAME_1:
  *        Field Names:            ARRAY OF STRINGS
@@ -62,6 +63,11 @@
  *                        SEGrid fields to PointGrid fields on the fly, to save on output size)
  *  - Max Snapshots Per File: the maximum number of snapshots saved per file. After this many
  *    snapshots, the current files is closed and a new file created.
+ *  - significant_digits: if positive, output data is quantized on device (before being copied
+ *    to host) so that only this many significant decimal digits are retained. The trailing
+ *    mantissa bits are zeroed, which makes the data much more compressible by netCDF. The
+ *    number of digits is stored in the 'quantization_nsd' attribute of each variable.
+ *    History restart files are never quantized.
  *  - Output: parameters for output control
  *    - Frequency: the frequency of output writes (in the units specified by ${Output frequency_units})
  *    - frequency_units: the units of output frequency (nsteps, nmonths, nyears, nhours, ndays,...)
@@ -138,7 +144,8 @@ public:
   void init();
   void reset_dev_views();
   void update_avg_cnt_view(const Field&, view_1d_dev& dev_view);
-  void setup_output_file (const std::string& filename, const std::string& fp_precision, const scorpio::FileMode mode);
+  void setup_output_file (const std::string& filename, const std::string& fp_precision, const scorpio::FileMode mode,
+                          const bool is_hist_restart_file = false);
   void run (const std::string& filename,
             const bool output_step, const bool checkpoint_step,
             const int nsteps_since_last_output,
@@ -164,7 +171,8 @@ protected:
   std::shared_ptr<const fm_type> get_field_manager (const std::string& mode) const;
 
   void register_dimensions(const std::string& name);
-  void register_variables(const std::string& filename, const std::string& fp_precision, const scorpio::FileMode mode);
+  void register_variables(const std::string& filename, const std::string& fp_precision, const scorpio::FileMode mode,
+                          const bool is_hist_restart_file);
   void set_degrees_of_freedom(const std::string& filename);
   std::vector<scorpio::offset_t> get_var_dof_offsets (const FieldLayout& layout);
   void register_views();
@@ -194,6 +202,10 @@ protected:
   OutputAvgType     m_avg_type;
   Real              m_avg_coeff_threshold = 0.5; // % of unfilled values required to not just assign value as FillValue
 
+  // Number of significant digits (and corresponding mantissa bits) kept in output files (0 means no quantization)
+  int               m_significant_digits = 0;
+  int               m_quantize_bits = 0;
+
   // Internal maps to the output fields, how the columns are distributed, the file dimensions and the global ids.
   std::vector<std::string>                              m_fields_names;
   std::vector<std::string>                              m_avg_cnt_names;
@@ -2,11 +2,19 @@
 #define SCREAM_IO_UTILS_HPP
 
 #include "share/util/scream_time_stamp.hpp"
+#include "share/scream_types.hpp"
 
 #include "ekat/util/ekat_string_utils.hpp"
 #include "ekat/mpi/ekat_comm.hpp"
 
+#include <Kokkos_Core.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <string>
+#include <type_traits>
 
 namespace scream
 {
@@ -131,6 +139,44 @@ struct IOFileSpecs {
 
 };
 
+// Number of explicit mantissa bits needed to retain nsd significant decimal digits.
+// This is the same estimate used by the netCDF BitGroom quantization.
+inline int nsd_to_mantissa_bits (const int nsd) {
+  return static_cast<int>(std::ceil(nsd*std::log2(10.0))) + 1;
+}
+
+// Round x to the nearest number with only keepbits explicit mantissa bits (ties to even),
+// and zero all the other mantissa bits (a.k.a. BitRound). The trailing zeros are what
+// makes quantized data compress much better. Inf/NaN values are returned unchanged.
+KOKKOS_INLINE_FUNCTION
+Real quantize (const Real x, const int keepbits) {
+  using UInt = typename std::conditional<sizeof(Real)==8,std::uint64_t,std::uint32_t>::type;
+  constexpr int mantissa_bits = std::numeric_limits<Real>::digits - 1;
+  constexpr int exp_bits = 8*sizeof(Real) - mantissa_bits - 1;
+  constexpr UInt exp_mask = ((UInt(1) << exp_bits) - 1) << mantissa_bits;
+
+  const int dropbits = mantissa_bits - keepbits;
+  if (dropbits<=0) {
+    return x;
+  }
+
+  UInt bits;
+  memcpy(&bits,&x,sizeof(Real));
+  if ((bits & exp_mask) == exp_mask) {
+    return x;
+  }
+
+  // Adding half ulp (minus one, plus the last kept bit, to get ties to even) and
+  // truncating rounds to nearest. A carry into the exponent is the correct result.
+  const UInt half = UInt(1) << (dropbits-1);
+  bits += half - 1 + ((bits >> dropbits) & 1);
+  bits &= ~((UInt(1) << dropbits) - 1);
+
+  Real y;
+  memcpy(&y,&bits,sizeof(Real));
+  return y;
+}
+
 std::string find_filename_in_rpointer (
     const std::string& casename,
     const bool model_restart,
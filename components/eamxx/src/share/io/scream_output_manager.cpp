@@ -708,7 +708,7 @@ setup_file (      IOFileSpecs& filespecs,
 
   // Make all output streams register their dims/vars
   for (auto& it : m_output_streams) {
-    it->setup_output_file(filename,fp_precision,mode);
+    it->setup_output_file(filename,fp_precision,mode,is_checkpoint_step);
   }
 
   // If grid data is needed,  also register geo data fields. Skip if file is resumed,
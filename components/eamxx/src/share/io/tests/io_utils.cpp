@@ -3,7 +3,9 @@
 #include <share/io/scream_io_utils.hpp>
 #include <share/util/scream_time_stamp.hpp>
 
+#include <cmath>
 #include <fstream>
+#include <vector>
 
 TEST_CASE ("find_filename_in_rpointer") {
   using namespace scream;
@@ -121,3 +123,41 @@ TEST_CASE ("io_control") {
     REQUIRE (not control.is_write_step(t3));
   }
 }
+
+TEST_CASE ("quantize") {
+  using namespace scream;
+
+  constexpr int mantissa_bits = std::numeric_limits<Real>::digits - 1;
+  constexpr int max_digits = std::numeric_limits<Real>::digits10;
+
+  const std::vector<Real> vals = {1, -1, 0, 3.14159265358979, -2.718281828459045,
+                                  1.0e-20, 6.02214076e23, 0.1, 123456.789};
+  for (int nsd=1; nsd<=max_digits; ++nsd) {
+    const int keepbits = nsd_to_mantissa_bits(nsd);
+    const Real tol = std::pow(Real(10),-nsd) / 2;
+    for (auto x : vals) {
+      const Real y = quantize(x,keepbits);
+
+      // The relative error must be within half a unit in the nsd-th digit
+      REQUIRE (std::abs(y-x) <= tol*std::abs(x));
+
+      // The dropped mantissa bits must be zero
+      if (keepbits<mantissa_bits) {
+        using UInt = typename std::conditional<sizeof(Real)==8,std::uint64_t,std::uint32_t>::type;
+        UInt bits;
+        std::memcpy(&bits,&y,sizeof(Real));
+        const UInt dropped = (UInt(1) << (mantissa_bits-keepbits)) - 1;
+        REQUIRE ((bits & dropped) == 0);
+      }
+
+      // Quantizing is idempotent
+      REQUIRE (quantize(y,keepbits)==y);
+    }
+  }
+
+  // Non-finite values are left untouched
+  const Real inf = std::numeric_limits<Real>::infinity();
+  REQUIRE (quantize(inf,5)==inf);
+  REQUIRE (quantize(-inf,5)==-inf);
+  REQUIRE (std::isnan(quantize(std::numeric_limits<Real>::quiet_NaN(),5)));
+}
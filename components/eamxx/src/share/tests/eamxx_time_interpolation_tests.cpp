@@ -13,6 +13,8 @@
 #include "share/io/scream_output_manager.hpp"
 
 #include "ekat/ekat_parameter_list.hpp"
+
+#include <cstdio>
 /*-----------------------------------------------------------------------------------------------
  * Test TimeInterpolation class
  *-----------------------------------------------------------------------------------------------*/
@@ -167,18 +169,30 @@ TEST_CASE ("eamxx_time_interpolation_data_from_file") {
   auto list_of_files = create_test_data_files(comm, grids_man, t0, seed);
   printf("   - create test data files...DONE\n");
 
-  // Construct a time interpolation object using the list of files with the data
+  // Construct a time interpolation object using the list of files with the data.
+  // The first object builds the time index and saves it, the others load it.
+  // The last one emulates a restart, starting half way through the data.
   printf(  "Constructing a time interpolation object ...\n");
-  util::TimeInterpolation time_interpolator(grid,list_of_files);
-  util::TimeInterpolation time_interpolator_deep(grid,list_of_files);
+  const std::string time_index_file = "eamxx_time_interpolation_test.time_index.txt";
+  if (comm.am_i_root()) {
+    std::remove(time_index_file.c_str());
+  }
+  comm.barrier();
+  util::TimeInterpolation time_interpolator(grid,list_of_files,time_index_file);
+  util::TimeInterpolation time_interpolator_deep(grid,list_of_files,time_index_file);
+  util::TimeInterpolation time_interpolator_restart(grid,list_of_files,time_index_file);
   for (auto name : fnames) {
     auto ff      = fields_man_t0->get_field(name);
     auto ff_deep = fields_man_deep->get_field(name);
     time_interpolator.add_field(ff);
     time_interpolator_deep.add_field(ff_deep,true);
+    time_interpolator_restart.add_field(ff);
   }
   time_interpolator.initialize_data_from_files();
   time_interpolator_deep.initialize_data_from_files();
+  const int restart_step = snap_freq*total_snaps/2 + 1;
+  const auto t_restart   = t0 + restart_step*dt;
+  time_interpolator_restart.initialize_data_from_files(t_restart);
   printf(  "Constructing a time interpolation object ... DONE\n");
 
   // Now check that the interpolator is working as expected.  Should be able to
@@ -209,6 +223,9 @@ TEST_CASE ("eamxx_time_interpolation_data_from_file") {
     }
     time_interpolator.perform_time_interpolation(ts);
     time_interpolator_deep.perform_time_interpolation(ts);
+    if (nn >= restart_step) {
+      time_interpolator_restart.perform_time_interpolation(ts);
+    }
     // Now compare the interp_fields to the fields in the field manager which should be updated.
     for (auto name : fnames) {
       auto field      = fields_man_t0->get_field(name);
@@ -219,6 +236,10 @@ TEST_CASE ("eamxx_time_interpolation_data_from_file") {
       REQUIRE(views_are_equal(field_deep,time_interpolator_deep.get_field(name)));
       // Check that the deep and shallow fields match showing that both approaches got the correct answer.
       REQUIRE(views_are_equal(field,field_deep));
+      // Check that the restarted interpolator gets the same answer.
+      if (nn >= restart_step) {
+        REQUIRE(views_are_equal(time_interpolator.get_field(name),time_interpolator_restart.get_field(name)));
+      }
     }
 
   }
@@ -226,8 +247,14 @@ TEST_CASE ("eamxx_time_interpolation_data_from_file") {
 
   time_interpolator.finalize();
   time_interpolator_deep.finalize();
+  time_interpolator_restart.finalize();
   printf("                        ... DONE\n");
 
+  comm.barrier();
+  if (comm.am_i_root()) {
+    std::remove(time_index_file.c_str());
+  }
+
   // All done with IO
   scorpio::eam_pio_finalize();
 
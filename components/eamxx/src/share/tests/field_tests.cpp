@@ -6,6 +6,7 @@
 #include "share/field/field_header.hpp"
 #include "share/field/field.hpp"
 #include "share/field/field_manager.hpp"
+#include "share/field/field_batch.hpp"
 #include "share/field/field_utils.hpp"
 #include "share/util/scream_setup_random_test.hpp"
 
@@ -862,6 +863,49 @@ TEST_CASE ("update") {
     f2.scale(2.0);
     REQUIRE (views_are_equal(f1, f2));
   }
+
+  SECTION ("batched_update") {
+    // A padded field, a static subfield, and a dynamic subfield (processed
+    // one at a time by the batch), all updated at once.
+    FieldIdentifier fid_p ("fp", {{COL,LEV},{ncol,nlev}}, kg, "some_grid", DataType::RealType);
+    Field f_pad (fid_p);
+    f_pad.get_header().get_alloc_properties().request_allocation(16);
+    f_pad.allocate_view();
+    randomize (f_pad,engine,rpdf);
+
+    std::vector<Field> x = {f_real, f_pad, f_real.subfield(1,1), f_real.subfield(1,2,true)};
+    std::vector<Field> y, y_ref;
+    for (const auto& f : x) {
+      y.push_back(f.clone());
+      y_ref.push_back(f.clone());
+      randomize (y.back(),engine,rpdf);
+      y_ref.back().deep_copy(y.back());
+    }
+
+    FieldBatch batch;
+    for (size_t i=0; i<x.size(); ++i) {
+      batch.add_pair(y[i],x[i]);
+    }
+    REQUIRE_THROWS (batch.update(1,1));
+    batch.finalize();
+    REQUIRE (batch.size()==4);
+    REQUIRE (batch.num_batched()==3);
+
+    batch.update(2,-1);
+    for (size_t i=0; i<x.size(); ++i) {
+      y_ref[i].update(x[i],2,-1);
+      REQUIRE (views_are_equal(y[i],y_ref[i]));
+    }
+
+    batch.deep_copy();
+    for (size_t i=0; i<x.size(); ++i) {
+      REQUIRE (views_are_equal(y[i],x[i]));
+    }
+
+    // Int fields are not supported
+    FieldBatch int_batch;
+    REQUIRE_THROWS (int_batch.add_pair(f_int.clone(),f_int));
+  }
 }
 
 } // anonymous namespace
@@ -338,6 +338,40 @@ void run(std::mt19937_64& engine, const ekat::Comm& comm, const gid_type src_min
       }
     }
   } 
+
+  // Test that the batched remap gives the same result as one field at a time,
+  // also when fields have different non-column extents.
+  view_3d<Real> x_3d_data_2("",unique_dofs_from_file.size(),num_bands+1,num_levels);
+  view_3d<Real> y_3d_data_2("",num_loc_tgt_cols,num_bands+1,num_levels);
+  view_3d<Real> y_3d_data_batched("",num_loc_tgt_cols,num_bands,num_levels);
+  view_3d<Real> y_3d_data_2_batched("",num_loc_tgt_cols,num_bands+1,num_levels);
+  auto x_3d_data_2_h = Kokkos::create_mirror_view(x_3d_data_2);
+  for (size_t ii=0;ii<unique_dofs_from_file.size();ii++) {
+    for (int nn=0; nn<num_bands+1; nn++) {
+      for (int kk=0; kk<num_levels; kk++) {
+        x_3d_data_2_h(ii,nn,kk) = x_data_from_file_h(ii)*(kk+2)*(nn+1);
+      }
+    }
+  }
+  Kokkos::deep_copy(x_3d_data_2,x_3d_data_2_h);
+  remap_from_file.apply_remap(x_3d_data_2,y_3d_data_2);
+  remap_from_file.apply_remap({x_3d_data,x_3d_data_2},{y_3d_data_batched,y_3d_data_2_batched});
+  auto y_3d_data_2_h         = Kokkos::create_mirror_view(y_3d_data_2);
+  auto y_3d_data_batched_h   = Kokkos::create_mirror_view(y_3d_data_batched);
+  auto y_3d_data_2_batched_h = Kokkos::create_mirror_view(y_3d_data_2_batched);
+  Kokkos::deep_copy(y_3d_data_2_h,y_3d_data_2);
+  Kokkos::deep_copy(y_3d_data_batched_h,y_3d_data_batched);
+  Kokkos::deep_copy(y_3d_data_2_batched_h,y_3d_data_2_batched);
+  for (int ii=0; ii<num_loc_tgt_cols; ii++) {
+    for (int kk=0; kk<num_levels; kk++) {
+      for (int nn=0; nn<num_bands; nn++) {
+        REQUIRE(y_3d_data_batched_h(ii,nn,kk)==y_3d_data_h(ii,nn,kk));
+      }
+      for (int nn=0; nn<num_bands+1; nn++) {
+        REQUIRE(y_3d_data_2_batched_h(ii,nn,kk)==y_3d_data_2_h(ii,nn,kk));
+      }
+    }
+  }
   
   
 } // end function run
@@ -0,0 +1,42 @@
+#include <catch2/catch.hpp>
+
+#include "share/util/eamxx_node_shared_data.hpp"
+
+namespace {
+
+TEST_CASE("node_shared_data") {
+  using namespace scream;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  const int n = 100;
+  NodeSharedData data(comm,n*sizeof(Real));
+  REQUIRE (data.size_in_bytes()==n*sizeof(Real));
+  REQUIRE (data.node_bytes_saved()==(data.get_node_comm().size()-1)*n*sizeof(Real));
+
+  // Cannot read before the data is finalized
+  REQUIRE_THROWS (data.get_data<Real>());
+
+  if (data.am_i_node_root()) {
+    auto ptr = data.get_data_for_write<Real>();
+    for (int i=0; i<n; ++i) {
+      ptr[i] = 2*i+1;
+    }
+  } else {
+    // Only the node root can write
+    REQUIRE_THROWS (data.get_data_for_write<Real>());
+  }
+  data.finalize_write();
+
+  // Cannot write after the data is finalized
+  REQUIRE_THROWS (data.get_data_for_write<Real>());
+
+  // All ranks on the node see the same data
+  auto v = data.get_view<Real>();
+  REQUIRE (v.extent_int(0)==n);
+  for (int i=0; i<n; ++i) {
+    REQUIRE (v(i)==2*i+1);
+  }
+}
+
+} // anonymous namespace
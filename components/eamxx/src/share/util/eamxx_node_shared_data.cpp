@@ -0,0 +1,46 @@
+#include "share/util/eamxx_node_shared_data.hpp"
+
+namespace scream {
+
+NodeSharedData::
+NodeSharedData (const ekat::Comm& comm, const size_t num_bytes)
+ : m_num_bytes (num_bytes)
+{
+  // Group the ranks that can share memory (i.e., that are on the same node)
+  MPI_Comm_split_type(comm.mpi_comm(),MPI_COMM_TYPE_SHARED,comm.rank(),MPI_INFO_NULL,&m_node_mpi_comm);
+  m_node_comm = ekat::Comm(m_node_mpi_comm);
+
+  // Only the node root allocates memory. All other ranks get a pointer to it.
+  const MPI_Aint my_bytes = am_i_node_root() ? m_num_bytes : 0;
+  char* my_ptr;
+  MPI_Win_allocate_shared(my_bytes,1,MPI_INFO_NULL,m_node_mpi_comm,&my_ptr,&m_win);
+
+  MPI_Aint root_bytes;
+  int disp_unit;
+  MPI_Win_shared_query(m_win,0,&root_bytes,&disp_unit,&m_data);
+  EKAT_REQUIRE_MSG (static_cast<size_t>(root_bytes)==m_num_bytes,
+      "Error! Unexpected size of node-shared memory window.\n"
+      "  - requested size: " + std::to_string(m_num_bytes) + "\n"
+      "  - window size   : " + std::to_string(root_bytes) + "\n");
+
+  // Open the access epoch for the node root writes
+  MPI_Win_fence(0,m_win);
+}
+
+NodeSharedData::~NodeSharedData ()
+{
+  MPI_Win_free(&m_win);
+  MPI_Comm_free(&m_node_mpi_comm);
+}
+
+void NodeSharedData::finalize_write ()
+{
+  EKAT_REQUIRE_MSG (not m_write_finalized,
+      "Error! NodeSharedData::finalize_write was already called.\n");
+
+  // Close the epoch: after this, all writes of the node root are visible on the node
+  MPI_Win_fence(0,m_win);
+  m_write_finalized = true;
+}
+
+} // namespace scream
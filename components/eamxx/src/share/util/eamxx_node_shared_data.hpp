@@ -0,0 +1,88 @@
+#ifndef EAMXX_NODE_SHARED_DATA_HPP
+#define EAMXX_NODE_SHARED_DATA_HPP
+
+#include "share/scream_types.hpp"
+
+#include "ekat/mpi/ekat_comm.hpp"
+#include "ekat/ekat_assert.hpp"
+
+#include <mpi.h>
+
+namespace scream {
+
+/*
+ * A NodeSharedData object holds a buffer of read-only data, which is stored
+ * only once per shared-memory node (via MPI_Win_allocate_shared), rather than
+ * once per rank. This is meant for large constant datasets (e.g., lookup
+ * tables) on CPU nodes, where many ranks would otherwise hold identical copies.
+ *
+ * Usage:
+ *   NodeSharedData data(comm,num_bytes);
+ *   if (data.am_i_node_root()) {
+ *     // fill data.get_data_for_write<T>()
+ *   }
+ *   data.finalize_write();
+ *   auto v = data.get_view<T>();
+ *
+ * The constructor and finalize_write are collective over the input comm.
+ * The data must only be accessed (read) after finalize_write is called, and
+ * must not be accessed after the object is destroyed (including via views).
+ */
+
+class NodeSharedData {
+public:
+  template<typename T>
+  using host_view_1d = Unmanaged<typename KokkosTypes<HostDevice>::template view_1d<T>>;
+
+  NodeSharedData (const ekat::Comm& comm, const size_t num_bytes);
+  ~NodeSharedData ();
+
+  NodeSharedData (const NodeSharedData&) = delete;
+  NodeSharedData& operator= (const NodeSharedData&) = delete;
+
+  const ekat::Comm& get_node_comm () const { return m_node_comm; }
+  bool am_i_node_root () const { return m_node_comm.am_i_root(); }
+
+  size_t size_in_bytes () const { return m_num_bytes; }
+
+  // Memory saved on this node w.r.t. storing one copy of the data per rank
+  size_t node_bytes_saved () const { return (m_node_comm.size()-1)*m_num_bytes; }
+
+  // Only the root rank of each node can write the data
+  template<typename T>
+  T* get_data_for_write () {
+    EKAT_REQUIRE_MSG (not m_write_finalized,
+        "Error! NodeSharedData can only be written before finalize_write is called.\n");
+    EKAT_REQUIRE_MSG (am_i_node_root(),
+        "Error! NodeSharedData can only be written by the root rank of each node.\n");
+    return reinterpret_cast<T*>(m_data);
+  }
+
+  // Make the data written by the node root visible to all ranks on the node
+  void finalize_write ();
+
+  template<typename T>
+  const T* get_data () const {
+    EKAT_REQUIRE_MSG (m_write_finalized,
+        "Error! NodeSharedData cannot be read before finalize_write is called.\n");
+    return reinterpret_cast<const T*>(m_data);
+  }
+
+  template<typename T>
+  host_view_1d<const T> get_view () const {
+    return host_view_1d<const T>(get_data<T>(),m_num_bytes/sizeof(T));
+  }
+
+protected:
+  MPI_Comm    m_node_mpi_comm;
+  ekat::Comm  m_node_comm;
+  MPI_Win     m_win;
+
+  char*       m_data;
+  size_t      m_num_bytes;
+  bool        m_write_finalized = false;
+};
+
+} // namespace scream
+
+#endif // EAMXX_NODE_SHARED_DATA_HPP
@@ -1,14 +1,36 @@
 #include "share/util/eamxx_time_interpolation.hpp"
 
+#include <algorithm>
+#include <fstream>
+
+#include <sys/stat.h>
+
 namespace scream{
 namespace util {
 
+namespace {
+// Size and modification time (in seconds) of a file, used to tell whether a time index is stale.
+// Both are -1 if the file cannot be stat'ed.
+void get_file_size_and_mtime(const std::string& filename, long long& size, long long& mtime)
+{
+  struct stat st;
+  if (stat(filename.c_str(),&st)==0) {
+    size  = st.st_size;
+    mtime = st.st_mtime;
+  } else {
+    size  = -1;
+    mtime = -1;
+  }
+}
+} // anonymous namespace
+
 /*-----------------------------------------------------------------------------------------------*/
 // Constructors
 TimeInterpolation::TimeInterpolation(
   const grid_ptr_type& grid 
 )
 {
+  m_comm = grid->get_comm();
   // Given the grid initialize field managers to store interpolation data
   m_fm_time0 = std::make_shared<FieldManager>(grid);
   m_fm_time1 = std::make_shared<FieldManager>(grid);
@@ -20,10 +42,16 @@ TimeInterpolation::TimeInterpolation(
 /*-----------------------------------------------------------------------------------------------*/
 TimeInterpolation::TimeInterpolation(
   const grid_ptr_type& grid, 
-  const vos_type& list_of_files
+  const vos_type& list_of_files,
+  const std::string& time_index_file
 ) : TimeInterpolation(grid)
 {
-  set_file_data_triplets(list_of_files);
+  if (time_index_file=="" or not read_time_index(time_index_file,list_of_files)) {
+    set_file_data_triplets(list_of_files);
+    if (time_index_file!="") {
+      write_time_index(time_index_file,list_of_files);
+    }
+  }
   m_is_data_from_file = true;
 }
 /*-----------------------------------------------------------------------------------------------*/
@@ -182,6 +210,23 @@ void TimeInterpolation::initialize_data_from_files()
   read_data();
 }
 /*-----------------------------------------------------------------------------------------------*/
+/* Same as above, but starting from the data that brackets a given timestamp rather than from the
+ * first snap of data. This way a restarted run reads the data it needs directly.
+ * Input:
+ *   ts_in - The timestamp the first time interpolation will be performed at.
+ */
+void TimeInterpolation::initialize_data_from_files(const TimeStamp& ts_in)
+{
+  // Find the last triplet at or before ts_in, making sure there is a triplet after it for time1.
+  const int ntriplets = m_file_data_triplets.size();
+  int idx = find_triplet_idx(ts_in,0);
+  if (idx==ntriplets or not (m_file_data_triplets[idx].timestamp==ts_in)) {
+    --idx;
+  }
+  m_triplet_idx = std::max(0,std::min(idx,ntriplets-2));
+  initialize_data_from_files();
+}
+/*-----------------------------------------------------------------------------------------------*/
 /* Function which will update the timestamps by shifting time1 to time0 and setting time1.
  * Input:
  *   ts_in - A timestamp for the most recent timestamp of the interpolation data.
@@ -306,6 +351,141 @@ void TimeInterpolation::set_file_data_triplets(const vos_type& list_of_files) {
   m_triplet_idx = 0;
 }	
 /*-----------------------------------------------------------------------------------------------*/
+/* Functions to save and load the sorted set of DataFromFileTriplets, so that runs using the same
+ * list of files do not need to open every file to gather its time axis.
+ * The time index file is a text file with the format
+ *   eamxx_time_index 2
+ *   <number of files>
+ *   <for each file, in the order of list_of_files: a line with the filename, and a line with its
+ *    size in bytes and modification time in seconds>
+ *   <number of triplets>
+ *   <one triplet per line: file number, time index, year, month, day, hour, minute, second>
+ * An index whose list of files does not match list_of_files, or whose files have since changed
+ * size or modification time, is considered stale and is rebuilt.
+ * The index is read by the root rank only, and broadcast to the other ranks.
+ */
+bool TimeInterpolation::read_time_index(const std::string& time_index_file, const vos_type& list_of_files)
+{
+  // Each triplet is read as 8 ints: file number, time index, year, month, day, hour, minute, second
+  constexpr int triplet_size = 8;
+  const int nfiles = list_of_files.size();
+  auto read_index = [&](std::vector<int>& data) -> bool {
+    std::ifstream ifs(time_index_file);
+    if (not ifs.good()) {
+      return false;
+    }
+    std::string tag;
+    int version, nfiles_in_index, ntriplets;
+    ifs >> tag >> version >> nfiles_in_index;
+    if (not ifs.good() or tag!="eamxx_time_index" or version!=2 or nfiles_in_index!=nfiles) {
+      return false;
+    }
+    std::string filename;
+    std::getline(ifs,filename);
+    for (int ii=0; ii<nfiles; ++ii) {
+      long long size, mtime, size_in_index, mtime_in_index;
+      std::getline(ifs,filename);
+      ifs >> size_in_index >> mtime_in_index;
+      if (ifs.fail() or filename!=list_of_files[ii]) {
+        return false;
+      }
+      get_file_size_and_mtime(filename,size,mtime);
+      if (size<0 or size!=size_in_index or mtime!=mtime_in_index) {
+        return false;
+      }
+      std::getline(ifs,filename);
+    }
+    ifs >> ntriplets;
+    if (ifs.fail() or ntriplets<0) {
+      return false;
+    }
+    data.resize(ntriplets*triplet_size);
+    for (auto& v : data) {
+      ifs >> v;
+    }
+    if (ifs.fail()) {
+      return false;
+    }
+    for (int it=0; it<ntriplets; ++it) {
+      const int file_idx = data[it*triplet_size];
+      if (file_idx<0 or file_idx>=nfiles) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  // Only the root rank reads the index, so that all ranks agree on whether it can be
+  // used: if not, they all need to call the (collective) set_file_data_triplets.
+  std::vector<int> data;
+  int ok = 0;
+  if (m_comm.am_i_root()) {
+    ok = read_index(data) ? 1 : 0;
+  }
+  m_comm.broadcast(&ok,1,m_comm.root_rank());
+  if (ok==0) {
+    return false;
+  }
+  int size = data.size();
+  m_comm.broadcast(&size,1,m_comm.root_rank());
+  data.resize(size);
+  m_comm.broadcast(data.data(),size,m_comm.root_rank());
+
+  const int ntriplets = size / triplet_size;
+  std::vector<DataFromFileTriplet> triplets(ntriplets);
+  for (int it=0; it<ntriplets; ++it) {
+    const int* v = &data[it*triplet_size];
+    auto& trip = triplets[it];
+    trip.filename  = list_of_files[v[0]];
+    trip.time_idx  = v[1];
+    trip.timestamp = TimeStamp(v[2],v[3],v[4],v[5],v[6],v[7]);
+  }
+  m_file_data_triplets = triplets;
+  m_triplet_idx = 0;
+  return true;
+}
+/*-----------------------------------------------------------------------------------------------*/
+void TimeInterpolation::write_time_index(const std::string& time_index_file, const vos_type& list_of_files) const
+{
+  if (m_comm.am_i_root()) {
+    std::map<std::string,int> file_idx;
+    for (size_t ii=0; ii<list_of_files.size(); ++ii) {
+      file_idx.emplace(list_of_files[ii],ii);
+    }
+    std::ofstream ofs(time_index_file);
+    EKAT_REQUIRE_MSG(ofs.good(),"Error! TimeInterpolation::write_time_index - could not open " << time_index_file << " for writing.\n");
+    ofs << "eamxx_time_index 2\n" << list_of_files.size() << "\n";
+    for (const auto& filename : list_of_files) {
+      long long size, mtime;
+      get_file_size_and_mtime(filename,size,mtime);
+      ofs << filename << "\n" << size << " " << mtime << "\n";
+    }
+    ofs << m_file_data_triplets.size() << "\n";
+    for (const auto& trip : m_file_data_triplets) {
+      const auto& ts = trip.timestamp;
+      ofs << file_idx.at(trip.filename) << " " << trip.time_idx << " "
+          << ts.get_year() << " " << ts.get_month() << " " << ts.get_day() << " "
+          << ts.get_hours() << " " << ts.get_minutes() << " " << ts.get_seconds() << "\n";
+    }
+  }
+  // Make sure the index is complete before any other TimeInterpolation tries to read it.
+  m_comm.barrier();
+}
+/*-----------------------------------------------------------------------------------------------*/
+/* Binary search of the sorted DataFromFileTriplets.
+ * Returns the index of the first triplet at or after first_idx with a timestamp >= ts_in, or the
+ * number of triplets if there is no such triplet.
+ */
+int TimeInterpolation::find_triplet_idx(const TimeStamp& ts_in, const int first_idx) const
+{
+  auto first = m_file_data_triplets.begin() + std::min<int>(first_idx,m_file_data_triplets.size());
+  auto it = std::lower_bound(first, m_file_data_triplets.end(), ts_in,
+                             [](const DataFromFileTriplet& trip, const TimeStamp& ts) {
+                               return trip.timestamp < ts;
+                             });
+  return std::distance(m_file_data_triplets.begin(),it);
+}
+/*-----------------------------------------------------------------------------------------------*/
 /* Function to read a new set of data from file using the current iterator pointing to the current
  * DataFromFileTriplet.
  */
@@ -345,19 +525,11 @@ void TimeInterpolation::check_and_update_data(const TimeStamp& ts_in)
 		  << "Current timestamp of " << ts_in.to_string() << " is lower than the TimeInterpolation bounds of " << m_time0.to_string());
   if (m_time1.seconds_from(ts_in) < 0) {
     // The timestamp is out of bounds, need to load new data.
-    // First cycle through the DataFromFileTriplet's to find a timestamp that is greater than this one.
-    bool found = false;
-    int step_cnt = 0; // Track how many triplets we passed to find one that worked. 
-    while (m_triplet_idx < static_cast<int>(m_file_data_triplets.size())) {
-      ++m_triplet_idx;
-      ++step_cnt;
-      auto ts_tmp = m_file_data_triplets[m_triplet_idx].timestamp;
-      if (ts_tmp.seconds_from(ts_in) >= 0) {
-        // This timestamp is greater than the input timestamp, we can use it
-	found = true;
-	break;
-      }
-    }
+    // First search the DataFromFileTriplet's for the first timestamp that is not less than this one.
+    const int new_idx = find_triplet_idx(ts_in,m_triplet_idx+1);
+    const bool found = new_idx < static_cast<int>(m_file_data_triplets.size());
+    const int step_cnt = new_idx - m_triplet_idx; // How many triplets we passed to find one that worked.
+    m_triplet_idx = new_idx;
     EKAT_REQUIRE_MSG(found,"ERROR!! TimeInterpolation::check_and_update_data - timestamp " << ts_in.to_string() << "is outside the bounds of the set of data files." << "\n"
 		   <<  "     TimeStamp time0: " << m_time0.to_string() << "\n"
 		   <<  "     TimeStamp time1: " << m_time1.to_string() << "\n");
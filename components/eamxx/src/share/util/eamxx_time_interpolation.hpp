@@ -22,13 +22,18 @@ public:
   // Constructors & Destructor
   TimeInterpolation() = default;
   TimeInterpolation(const grid_ptr_type& grid);
-  TimeInterpolation(const grid_ptr_type& grid, const vos_type& list_of_files);
+  // If time_index_file is not empty, the sorted time index of the data in
+  // list_of_files is read from that file if it exists and matches list_of_files,
+  // and otherwise is built and saved there for subsequent runs.
+  TimeInterpolation(const grid_ptr_type& grid, const vos_type& list_of_files,
+                    const std::string& time_index_file = "");
   ~TimeInterpolation () = default;
 
   // Running the interpolation
   void initialize_timestamps(const TimeStamp& ts_in);
   void initialize_data_from_field(const Field& field_in);
   void initialize_data_from_files();
+  void initialize_data_from_files(const TimeStamp& ts_in);
   void update_data_from_field(const Field& field_in);
   void update_timestamp(const TimeStamp& ts_in);
   void perform_time_interpolation(const TimeStamp& time_in);
@@ -66,9 +71,14 @@ protected:
 
   // For the case where forcing data comes from files
   void set_file_data_triplets(const vos_type& list_of_files);
+  bool read_time_index(const std::string& time_index_file, const vos_type& list_of_files);
+  void write_time_index(const std::string& time_index_file, const vos_type& list_of_files) const;
+  int  find_triplet_idx(const TimeStamp& ts_in, const int first_idx) const;
   void read_data();
   void check_and_update_data(const TimeStamp& ts_in);
 
+  ekat::Comm m_comm;
+
   // Local field managers used to store two time snaps of data for interpolation
   fm_type  m_fm_time0;
   fm_type  m_fm_time1;
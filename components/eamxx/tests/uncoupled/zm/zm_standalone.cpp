@@ -2,11 +2,12 @@
 #include "control/atmosphere_driver.hpp"
 #include "diagnostics/register_diagnostics.hpp"
 
-#include "physics/zm/atmosphere_deep_convection.hpp"
+#include "physics/zm/eamxx_zm_process_interface.hpp"
 #include "physics/zm/scream_zm_interface.hpp"
 
 #include "share/grid/mesh_free_grids_manager.hpp"
 #include "share/atm_process/atmosphere_process.hpp"
+#include "share/field/field_utils.hpp"
 
 #include "ekat/ekat_parse_yaml_file.hpp"
 
@@ -15,14 +16,14 @@
 
 namespace scream {
 
-TEST_CASE("zm-standalone", "") {
+// Run ZM with the given column batch size (if positive), and return a copy of all the fields
+std::map<std::string,Field> run_zm (ekat::ParameterList ad_params, const int batch_size) {
   using namespace scream;
   using namespace scream::control;
 
-  // Load ad parameter list
-  std::string fname = "input.yaml";
-  ekat::ParameterList ad_params("Atmosphere Driver");
-  parse_yaml_file(fname,ad_params);
+  if (batch_size>0) {
+    ad_params.sublist("atmosphere_processes").sublist("zm").set("column_batch_size",batch_size);
+  }
 
   // Time stepping parameters
   const auto& ts     = ad_params.sublist("time_stepping");
@@ -36,17 +37,6 @@ TEST_CASE("zm-standalone", "") {
   // Create a comm
   ekat::Comm atm_comm (MPI_COMM_WORLD);
   
-  // Need to register products in the factory *before* we create any AtmosphereProcessGroup,
-  // which rely on factory for process creation. The initialize method of the AD does that.
-  // While we're at it, check that the case insensitive key of the factory works.
-  
-  // Need to register grids managers before we create the driver
-  auto& proc_factory = AtmosphereProcessFactory::instance();
-  auto& gm_factory = GridsManagerFactory::instance();
-  proc_factory.register_product("ZM",&create_atmosphere_process<ZMDeepConvection>);
-  gm_factory.register_product("Mesh Free",&create_mesh_free_grids_manager);
-  register_diagnostics();
-
   // Create the driver
   AtmosphereDriver ad;
 
@@ -58,10 +48,43 @@ TEST_CASE("zm-standalone", "") {
     std::cout << "  - Iteration " << std::setfill(' ') << std::setw(3) << i+1 << " completed";
     std::cout << "       [" << std::setfill(' ') << std::setw(3) << 100*(i+1)/nsteps << "%]\n";
   }
+
+  std::map<std::string,Field> fields;
+  for (const auto& it : *ad.get_field_mgr("Physics")) {
+    fields.emplace(it.first,it.second->clone());
+  }
   ad.finalize();
 
-  // If we got here, we were able to run zm 
-  REQUIRE(true);
+  return fields;
+}
+
+TEST_CASE("zm-standalone", "") {
+  // Load ad parameter list
+  std::string fname = "input.yaml";
+  ekat::ParameterList ad_params("Atmosphere Driver");
+  parse_yaml_file(fname,ad_params);
+
+  // Need to register products in the factory *before* we create any AtmosphereProcessGroup,
+  // which rely on factory for process creation. The initialize method of the AD does that.
+  // While we're at it, check that the case insensitive key of the factory works.
+  
+  // Need to register grids managers before we create the driver
+  auto& proc_factory = AtmosphereProcessFactory::instance();
+  auto& gm_factory = GridsManagerFactory::instance();
+  proc_factory.register_product("ZM",&create_atmosphere_process<ZMDeepConvection>);
+  gm_factory.register_product("Mesh Free",&create_mesh_free_grids_manager);
+  register_diagnostics();
+
+  // Run ZM with all columns in one batch, and in several (uneven) batches,
+  // which must give the same answers.
+  const auto unbatched = run_zm(ad_params,-1);
+  const auto batched   = run_zm(ad_params,5);
+
+  REQUIRE (unbatched.size()==batched.size());
+  for (const auto& it : unbatched) {
+    REQUIRE (batched.count(it.first)==1);
+    REQUIRE (views_are_equal(it.second,batched.at(it.first)));
+  }
 }
 
 } // namespace scream
@@ -25,8 +25,17 @@ struct CDR {
     // the level of 10 to 1000 times numeric_limits<Real>::epsilon().
     bool prefer_numerical_mass_conservation_to_numerical_bounds;
 
+    // QLT only. Assign the tree's non-leaf nodes to ranks such that only the
+    // leader of each shared-memory node communicates with other shared-memory
+    // nodes. See tree::set_node_aware_ranks. If the bulk data are on host,
+    // messages within a shared-memory node also go through an MPI-3
+    // shared-memory window; see tree::SharedMemoryMessages. Results are BFB
+    // with the default.
+    bool node_aware_tree;
+
     Options ()
-      : prefer_numerical_mass_conservation_to_numerical_bounds(false)
+      : prefer_numerical_mass_conservation_to_numerical_bounds(false),
+        node_aware_tree(false)
     {}
   };
 
@@ -8,6 +8,7 @@
 
 #include <cassert>
 #include <cmath>
+#include <cstdlib>
 
 #include <set>
 #include <limits>
@@ -62,17 +63,56 @@ public:
 #endif
   }
 #undef tpr
+  // Per-level timers accumulate l2r and r2l time spent in a level.
+  static inline void reset_levels () {
+#ifdef COMPOSE_QLT_TIME
+    lvl_et_.clear();
+#endif
+  }
+  static inline void start_level () {
+#ifdef COMPOSE_QLT_TIME
+    gettimeofday(&t_lvl_start_, 0);
+#endif
+  }
+  static inline void stop_level (const size_t il) {
+#ifdef COMPOSE_QLT_TIME
+    timeval t2;
+    gettimeofday(&t2, 0);
+    const timeval& t1 = t_lvl_start_;
+    static const double us = 1.0e6;
+    if (lvl_et_.size() <= il) lvl_et_.resize(il+1, 0);
+    lvl_et_[il] += (t2.tv_sec*us + t2.tv_usec - t1.tv_sec*us - t1.tv_usec)/us;
+#endif
+  }
+  // Collective. Print the max over ranks of each level's time.
+  static void print_levels (const Parallel& p, const char* name) {
+#ifdef COMPOSE_QLT_TIME
+    Int nlvl = lvl_et_.size(), gnlvl;
+    mpi::all_reduce(p, &nlvl, &gnlvl, 1, MPI_MAX);
+    std::vector<double> et(gnlvl, 0), gmax(gnlvl);
+    std::copy(lvl_et_.begin(), lvl_et_.end(), et.begin());
+    mpi::reduce(p, et.data(), gmax.data(), gnlvl, MPI_MAX, p.root());
+    if ( ! p.amroot()) return;
+    printf("%s: level max time (l2r + r2l)\n", name);
+    for (Int il = 0; il < gnlvl; ++il)
+      printf("  %3d %10.3e\n", il, gmax[il]);
+#endif
+  }
 private:
 #ifdef COMPOSE_QLT_TIME
   static timeval t_start_[NTIMERS];
   static double et_[NTIMERS];
   static int cnt_[NTIMERS];
+  static timeval t_lvl_start_;
+  static std::vector<double> lvl_et_;
 #endif
 };
 #ifdef COMPOSE_QLT_TIME
 timeval Timer::t_start_[Timer::NTIMERS];
 double Timer::et_[Timer::NTIMERS];
 int Timer::cnt_[Timer::NTIMERS];
+timeval Timer::t_lvl_start_;
+std::vector<double> Timer::lvl_et_;
 #endif
 
 template <typename ES>
@@ -208,6 +248,8 @@ void QLT<ES>::init (const Parallel::Ptr& p, const Int& ncells,
                     const tree::Node::Ptr& tree) {
   p_ = p;
   Timer::start(Timer::analyze);
+  if (get_options().node_aware_tree)
+    tree::set_node_aware_ranks(tree::SharedMemoryNodes(p), tree);
   ns_ = tree::analyze(p, ncells, tree);
   nshd_ = std::make_shared<tree::NodeSetsHostData>();
   nsdd_ = std::make_shared<tree::NodeSetsDeviceData<ES> >();
@@ -306,6 +348,10 @@ void QLT<ES>::set_buffers (Real* buf1, Real* buf2) {
 
 template <typename ES>
 void QLT<ES>::finish_setup () {
+  if (options_.node_aware_tree && ! cedr::impl::OnGpu<ES>::value && ! smm_)
+    smm_ = std::make_shared<tree::SharedMemoryMessages>(
+      p_, ns_, o.md_.a_h.prob2bl2r[o.md_.nprobtypes],
+      o.md_.a_h.prob2br2l[o.md_.nprobtypes]);
   if (o.bd_.inited()) return;
   size_t l2r_sz, r2l_sz;
   get_buffers_sizes(l2r_sz, r2l_sz);
@@ -325,14 +371,18 @@ Int QLT<ES>::get_num_tracers () const {
 }
 
 template <typename ES> void QLT<ES>
-::l2r_recv (const tree::NodeSets::Level& lvl, const Int& l2rndps) const {
+::l2r_recv (const Int& lvlidx, const Int& l2rndps) const {
+  const auto& lvl = ns_->levels[lvlidx];
+  Int nreq = 0;
   for (size_t i = 0; i < lvl.kids.size(); ++i) {
+    if (smm_ && smm_->kid_is_local(lvlidx, i)) continue;
     const auto& mmd = lvl.kids[i];
     mpi::irecv(*p_, o.bd_.l2r_data.data() + mmd.offset*l2rndps, mmd.size*l2rndps,
-               mmd.rank, tree::NodeSets::mpitag, &lvl.kids_req[i]);
+               mmd.rank, tree::NodeSets::mpitag, &lvl.kids_req[nreq++]);
   }
   Timer::start(Timer::waitall);
-  mpi::waitall(lvl.kids_req.size(), lvl.kids_req.data());
+  if (smm_) smm_->l2r_recv(lvlidx, o.bd_.l2r_data.data());
+  mpi::waitall(nreq, lvl.kids_req.data());
   Timer::stop(Timer::waitall);
 }
 
@@ -430,8 +480,11 @@ template <typename ES> void QLT<ES>
 }
 
 template <typename ES> void QLT<ES>
-::l2r_send_to_parents (const tree::NodeSets::Level& lvl, const Int& l2rndps) const {
+::l2r_send_to_parents (const Int& lvlidx, const Int& l2rndps) const {
+  const auto& lvl = ns_->levels[lvlidx];
+  if (smm_) smm_->l2r_send_to_parents(lvlidx, o.bd_.l2r_data.data());
   for (size_t i = 0; i < lvl.me.size(); ++i) {
+    if (smm_ && smm_->me_is_local(lvlidx, i)) continue;
     const auto& mmd = lvl.me[i];
     mpi::isend(*p_, o.bd_.l2r_data.data() + mmd.offset*l2rndps, mmd.size*l2rndps,
                mmd.rank, tree::NodeSets::mpitag);
@@ -476,14 +529,18 @@ template <typename ES> void QLT<ES>
 }
 
 template <typename ES> void QLT<ES>
-::r2l_recv (const tree::NodeSets::Level& lvl, const Int& r2lndps) const {
+::r2l_recv (const Int& lvlidx, const Int& r2lndps) const {
+  const auto& lvl = ns_->levels[lvlidx];
+  Int nreq = 0;
   for (size_t i = 0; i < lvl.me.size(); ++i) {
+    if (smm_ && smm_->me_is_local(lvlidx, i)) continue;
     const auto& mmd = lvl.me[i];
     mpi::irecv(*p_, o.bd_.r2l_data.data() + mmd.offset*r2lndps, mmd.size*r2lndps,
-               mmd.rank, tree::NodeSets::mpitag, &lvl.me_recv_req[i]);
+               mmd.rank, tree::NodeSets::mpitag, &lvl.me_recv_req[nreq++]);
   }
   Timer::start(Timer::waitall);
-  mpi::waitall(lvl.me_recv_req.size(), lvl.me_recv_req.data());
+  if (smm_) smm_->r2l_recv(lvlidx, o.bd_.r2l_data.data());
+  mpi::waitall(nreq, lvl.me_recv_req.data());
   Timer::stop(Timer::waitall);
 }
 
@@ -604,8 +661,11 @@ template <typename ES> void QLT<ES>
 }
 
 template <typename ES> void QLT<ES>
-::r2l_send_to_kids (const tree::NodeSets::Level& lvl, const Int& r2lndps) const {
+::r2l_send_to_kids (const Int& lvlidx, const Int& r2lndps) const {
+  const auto& lvl = ns_->levels[lvlidx];
+  if (smm_) smm_->r2l_send_to_kids(lvlidx, o.bd_.r2l_data.data());
   for (size_t i = 0; i < lvl.kids.size(); ++i) {
+    if (smm_ && smm_->kid_is_local(lvlidx, i)) continue;
     const auto& mmd = lvl.kids[i];
     mpi::isend(*p_, o.bd_.r2l_data.data() + mmd.offset*r2lndps, mmd.size*r2lndps,
                mmd.rank, tree::NodeSets::mpitag);
@@ -622,19 +682,24 @@ void QLT<ES>::run () {
   // Number of data per slot.
   const Int l2rndps = o.md_.a_h.prob2bl2r[o.md_.nprobtypes];
   const Int r2lndps = o.md_.a_h.prob2br2l[o.md_.nprobtypes];
+  if (smm_) smm_->start_run();
   for (size_t il = 0; il < ns_->levels.size(); ++il) {
     auto& lvl = ns_->levels[il];
-    if (lvl.kids.size()) l2r_recv(lvl, l2rndps);
+    Timer::start_level();
+    if (lvl.kids.size()) l2r_recv(il, l2rndps);
     l2r_combine_kid_data(il, l2rndps);    
-    if (lvl.me.size()) l2r_send_to_parents(lvl, l2rndps);
+    if (lvl.me.size()) l2r_send_to_parents(il, l2rndps);
+    Timer::stop_level(il);
   }
   Timer::stop(Timer::qltrunl2r); Timer::start(Timer::qltrunr2l);
   root_compute(l2rndps, r2lndps);
   for (size_t il = ns_->levels.size(); il > 0; --il) {
     auto& lvl = ns_->levels[il-1];
-    if (lvl.me.size()) r2l_recv(lvl, r2lndps);
+    Timer::start_level();
+    if (lvl.me.size()) r2l_recv(il-1, r2lndps);
     r2l_solve_qp(il-1, l2rndps, r2lndps);
-    if (lvl.kids.size()) r2l_send_to_kids(lvl, r2lndps);
+    if (lvl.kids.size()) r2l_send_to_kids(il-1, r2lndps);
+    Timer::stop_level(il-1);
   }
   Timer::stop(Timer::qltrunr2l);
 }
@@ -725,6 +790,7 @@ private:
       Timer::reset(Timer::qltrunr2l);
       Timer::reset(Timer::waitall);
       Timer::reset(Timer::snp);
+      Timer::reset_levels();
     }
   }
 };
@@ -740,6 +806,40 @@ Int test_qlt (const Parallel::Ptr& p, const tree::Node::Ptr& tree,
   return TestQLT(p, tree, ncells, external_memory, verbose, options)
     .run<TestQLT::QLTT>(nrepeat, write);
 }
+
+// Run QLT on the default and the node-aware trees over m, the latter with MPI
+// and with shared-memory messages within the real shared-memory nodes, and
+// check that the results are BFB.
+Int test_qlt_node_aware (const Parallel::Ptr& p, const tree::oned::Mesh& m,
+                         const tree::SharedMemoryNodes& smn, const Int nrepeat,
+                         const bool print_timers) {
+  static const char* names[] = {"default tree", "node-aware tree",
+                                "node-aware tree, shared memory"};
+  Int nerr = 0;
+  std::vector<Real> Qm[3];
+  for (Int i = 0; i < 3; ++i) {
+    tree::Node::Ptr tree = make_tree(m, false);
+    if (i > 0) tree::set_node_aware_ranks(smn, tree);
+    CDR::Options options;
+    options.node_aware_tree = i == 2;
+    if (options.node_aware_tree && cedr::impl::OnGpu<Kokkos::DefaultExecutionSpace>::value)
+      continue;
+    // Same problem data for all trees.
+    srand(p->rank() + 1);
+    nerr += TestQLT(p, tree, m.ncell(), false, false, options)
+      .run<TestQLT::QLTT>(nrepeat, false, &Qm[i]);
+    if (print_timers) Timer::print_levels(*p, names[i]);
+  }
+  for (Int i = 1; i < 3; ++i) {
+    if (Qm[i].empty()) continue;
+    if (Qm[0].size() != Qm[i].size())
+      ++nerr;
+    else
+      for (size_t j = 0; j < Qm[0].size(); ++j)
+        if (Qm[0][j] != Qm[i][j]) ++nerr;
+  }
+  return nerr;
+}
 } // namespace test
 
 Int unittest_QLT (const Parallel::Ptr& p, const bool write_requested=false) {
@@ -768,6 +868,15 @@ Int unittest_QLT (const Parallel::Ptr& p, const bool write_requested=false) {
       }
     }
   }
+  // Emulate shared-memory nodes of 2 ranks so inter-node levels are exercised
+  // even when all ranks are on one node.
+  for (size_t id = 0, idlim = sizeof(dists)/sizeof(*dists); id < idlim; ++id) {
+    Mesh m(7*p->size(), p, dists[id]);
+    const Int ne = test::test_qlt_node_aware(p, m, tree::SharedMemoryNodes(p, 2),
+                                             2, false);
+    if (ne && p->amroot()) std::cout << " node-aware tree is not BFB";
+    nerr += ne;
+  }
   return nerr;
 }
 
@@ -793,6 +902,13 @@ Int run_unit_and_randomized_tests (const Parallel::Ptr& p, const Input& in) {
     test::test_qlt(p, tree, in.ncells, in.nrepeat, false, false, false, in.verbose);
     Timer::stop(Timer::total);
     if (p->amroot()) Timer::print();
+    // Compare per-level timing of the default and node-aware trees.
+    const tree::SharedMemoryNodes smn(p);
+    if (p->amroot())
+      std::cout << "node-aware: " << smn.nnode() << " shared-memory nodes\n";
+    const Int ne = test::test_qlt_node_aware(p, m, smn, in.nrepeat, true);
+    if (ne && p->amroot()) std::cerr << "FAIL: node-aware tree is not BFB\n";
+    nerr += ne;
   }
   return nerr;
 }
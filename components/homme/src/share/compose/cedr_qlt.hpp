@@ -200,6 +200,9 @@ protected:
   // Data extracted from ns_ for use in run() on device.
   std::shared_ptr<tree::NodeSetsDeviceData<ExeSpace> > nsdd_;
   std::shared_ptr<tree::NodeSetsHostData> nshd_;
+  // Messages within a shared-memory node, if Options::node_aware_tree and the
+  // bulk data are on host.
+  tree::SharedMemoryMessages::Ptr smm_;
   // Globally unique cellidx -> rank-local index.
   typedef std::map<Int,Int> Gci2LciMap;
   std::shared_ptr<Gci2LciMap> gci2lci_;
@@ -209,13 +212,13 @@ protected:
   DeviceOp o;
 
 PRIVATE_CUDA:
-  void l2r_recv(const tree::NodeSets::Level& lvl, const Int& l2rndps) const;
+  void l2r_recv(const Int& lvlidx, const Int& l2rndps) const;
   void l2r_combine_kid_data(const Int& lvlidx, const Int& l2rndps) const;
-  void l2r_send_to_parents(const tree::NodeSets::Level& lvl, const Int& l2rndps) const;
+  void l2r_send_to_parents(const Int& lvlidx, const Int& l2rndps) const;
   void root_compute(const Int& l2rndps, const Int& r2lndps) const;
-  void r2l_recv(const tree::NodeSets::Level& lvl, const Int& r2lndps) const;
+  void r2l_recv(const Int& lvlidx, const Int& r2lndps) const;
   void r2l_solve_qp(const Int& lvlidx, const Int& l2rndps, const Int& r2lndps) const;
-  void r2l_send_to_kids(const tree::NodeSets::Level& lvl, const Int& r2lndps) const;
+  void r2l_send_to_kids(const Int& lvlidx, const Int& r2lndps) const;
 };
 
 namespace test {
@@ -8,6 +8,7 @@
 #include "cedr_mpi.hpp"
 #include "cedr_util.hpp"
 
+#include <algorithm>
 #include <vector>
 
 namespace cedr {
@@ -22,8 +23,11 @@ public:
   // The subclass should call this, probably in its constructor.
   void init();
 
+  // If Qm is provided, it gets this rank's final Qm values, tracer-major, for
+  // comparison across CDR configurations.
   template <typename CDRT, typename ExeSpace = Kokkos::DefaultExecutionSpace>
-  Int run(const Int nrepeat = 1, const bool write=false);
+  Int run(const Int nrepeat = 1, const bool write=false,
+          std::vector<Real>* Qm = nullptr);
 
 private:
   const std::string cdr_name_;
@@ -10,7 +10,8 @@ namespace cedr {
 namespace test {
 
 template <typename CDRT, typename ES>
-Int TestRandomized::run (const Int nrepeat, const bool write) {
+Int TestRandomized::run (const Int nrepeat, const bool write,
+                         std::vector<Real>* Qm) {
   const Int nt = tracers_.size(), nlclcells = gcis_.size();
 
   Values v(nt, nlclcells);
@@ -58,6 +59,12 @@ Int TestRandomized::run (const Int nrepeat, const bool write) {
   }
   vd.sync_host(); // => v contains computed values
 
+  if (Qm) {
+    Qm->resize(nt*nlclcells);
+    for (Int ti = 0; ti < nt; ++ti)
+      std::copy(v.Qm(ti), v.Qm(ti) + nlclcells, Qm->data() + ti*nlclcells);
+  }
+
   if (write)
     for (const auto& t : tracers_)
       write_post(t, v);
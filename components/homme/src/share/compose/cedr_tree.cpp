@@ -1,5 +1,7 @@
 #include "cedr_tree.hpp"
 
+#include <algorithm>
+#include <map>
 #include <set>
 
 namespace cedr {
@@ -230,6 +232,200 @@ NodeSets::ConstPtr analyze (const Parallel::Ptr& p, const Int& ncells,
   return nodesets;
 }
 
+SharedMemoryNodes::SharedMemoryNodes (const Parallel::Ptr& p)
+  : leader_(p->size())
+{
+  MPI_Comm shm;
+  MPI_Comm_split_type(p->comm(), MPI_COMM_TYPE_SHARED, p->rank(), MPI_INFO_NULL,
+                      &shm);
+  Int my_rank = p->rank(), my_leader;
+  MPI_Allreduce(&my_rank, &my_leader, 1, mpi::get_type<Int>(), MPI_MIN, shm);
+  MPI_Comm_free(&shm);
+  MPI_Allgather(&my_leader, 1, mpi::get_type<Int>(), leader_.data(), 1,
+                mpi::get_type<Int>(), p->comm());
+  init_nnode();
+}
+
+SharedMemoryNodes::SharedMemoryNodes (const Parallel::Ptr& p,
+                                      const Int& ranks_per_node)
+  : leader_(p->size())
+{
+  cedr_assert(ranks_per_node > 0);
+  for (Int r = 0; r < p->size(); ++r)
+    leader_[r] = (r / ranks_per_node)*ranks_per_node;
+  init_nnode();
+}
+
+void SharedMemoryNodes::init_nnode () {
+  nnode_ = 0;
+  for (size_t r = 0; r < leader_.size(); ++r)
+    if (leader_[r] == static_cast<Int>(r)) ++nnode_;
+}
+
+void set_node_aware_ranks (const SharedMemoryNodes& smn, const tree::Node::Ptr& node) {
+  if (node->nkids <= 0) return;
+  for (Int i = 0; i < node->nkids; ++i)
+    set_node_aware_ranks(smn, node->kids[i]);
+  if (node->rank >= 0) return;
+  const Int r0 = node->kids[0]->rank;
+  cedr_assert(r0 >= 0);
+  node->rank = r0;
+  if (node->nkids == 2 && ! smn.same_node(r0, node->kids[1]->rank))
+    node->rank = smn.leader(r0);
+}
+
+SharedMemoryMessages
+::SharedMemoryMessages (const Parallel::Ptr& p, const NodeSets::ConstPtr& ns,
+                        const Int& l2rndps, const Int& r2lndps)
+  : ns_(ns), l2rndps_(l2rndps), r2lndps_(r2lndps), seq_(0)
+{
+  MPI_Comm_split_type(p->comm(), MPI_COMM_TYPE_SHARED, p->rank(), MPI_INFO_NULL,
+                      &shm_);
+  int shm_rank, shm_size;
+  MPI_Comm_rank(shm_, &shm_rank);
+  MPI_Comm_size(shm_, &shm_size);
+  // Map p's ranks to shm_'s.
+  std::vector<Int> shm2p(shm_size);
+  const Int my_rank = p->rank();
+  MPI_Allgather(&my_rank, 1, mpi::get_type<Int>(), shm2p.data(), 1,
+                mpi::get_type<Int>(), shm_);
+  std::map<Int,Int> p2shm;
+  for (Int i = 0; i < shm_size; ++i) p2shm[shm2p[i]] = i;
+
+  // Allocate and init my segment. Only the owner writes a segment's flags.
+  void* base;
+  MPI_Win_allocate_shared(ns_->nslots*(2*sizeof(Long) + (l2rndps_ + r2lndps_)*sizeof(Real)),
+                          1, MPI_INFO_NULL, shm_, &base, &win_);
+  MPI_Win_lock_all(MPI_MODE_NOCHECK, win_);
+  my_seg_ = get_segment(shm_rank);
+  for (Int i = 0; i < ns_->nslots; ++i) {
+    my_seg_.l2r_flag[i] = 0;
+    my_seg_.r2l_flag[i] = 0;
+  }
+  MPI_Win_sync(win_);
+  MPI_Barrier(shm_);
+
+  // Find the local messages.
+  Int nreq = 0;
+  msgs_.resize(ns_->levels.size());
+  const auto init = [&] (const std::vector<NodeSets::Level::MPIMetaData>& mmds,
+                         std::vector<Message>& msgs) {
+    msgs.resize(mmds.size());
+    for (size_t i = 0; i < mmds.size(); ++i) {
+      const auto it = p2shm.find(mmds[i].rank);
+      msgs[i].local = it != p2shm.end();
+      if ( ! msgs[i].local) continue;
+      msgs[i].seg = get_segment(it->second);
+      nreq += 2;
+    }
+  };
+  for (size_t il = 0; il < ns_->levels.size(); ++il) {
+    init(ns_->levels[il].me, msgs_[il].me);
+    init(ns_->levels[il].kids, msgs_[il].kids);
+  }
+
+  // Exchange offsets with the partners. Messages between a pair of ranks are
+  // posted in level order on both sides, as in a run.
+  const int l2rtag = NodeSets::mpitag + 1, r2ltag = NodeSets::mpitag + 2;
+  std::vector<mpi::Request> reqs(nreq);
+  nreq = 0;
+  for (size_t il = 0; il < ns_->levels.size(); ++il) {
+    const auto& lvl = ns_->levels[il];
+    auto& ml = msgs_[il];
+    for (size_t i = 0; i < lvl.me.size(); ++i) {
+      if ( ! ml.me[i].local) continue;
+      mpi::isend(*p, &lvl.me[i].offset, 1, lvl.me[i].rank, l2rtag, &reqs[nreq++]);
+      mpi::irecv(*p, &ml.me[i].offset, 1, lvl.me[i].rank, r2ltag, &reqs[nreq++]);
+    }
+    for (size_t i = 0; i < lvl.kids.size(); ++i) {
+      if ( ! ml.kids[i].local) continue;
+      mpi::irecv(*p, &ml.kids[i].offset, 1, lvl.kids[i].rank, l2rtag, &reqs[nreq++]);
+      mpi::isend(*p, &lvl.kids[i].offset, 1, lvl.kids[i].rank, r2ltag, &reqs[nreq++]);
+    }
+  }
+  mpi::waitall(nreq, reqs.data());
+}
+
+SharedMemoryMessages::~SharedMemoryMessages () {
+  int fin;
+  MPI_Finalized(&fin);
+  if (fin) return;
+  MPI_Win_unlock_all(win_);
+  MPI_Win_free(&win_);
+  MPI_Comm_free(&shm_);
+}
+
+SharedMemoryMessages::Segment
+SharedMemoryMessages::get_segment (const Int& shm_rank) const {
+  MPI_Aint sz;
+  int disp_unit;
+  void* base;
+  MPI_Win_shared_query(win_, shm_rank, &sz, &disp_unit, &base);
+  const Int nslots = sz / (2*sizeof(Long) + (l2rndps_ + r2lndps_)*sizeof(Real));
+  Segment seg;
+  seg.l2r_flag = static_cast<Long*>(base);
+  seg.r2l_flag = seg.l2r_flag + nslots;
+  seg.l2r_data = reinterpret_cast<Real*>(static_cast<Long*>(base) + 2*nslots);
+  seg.r2l_data = seg.l2r_data + nslots*l2rndps_;
+  return seg;
+}
+
+void SharedMemoryMessages
+::send (const Int& os, const Int& sz, const Real* data, const Int& ndps,
+        Real* seg_data, volatile Long* seg_flag) const {
+  std::copy(data + os*ndps, data + (os + sz)*ndps, seg_data + os*ndps);
+  // Make the data visible before the flag.
+  MPI_Win_sync(win_);
+  seg_flag[os] = seq_;
+}
+
+void SharedMemoryMessages
+::recv (const Int& seg_os, const Int& os, const Int& sz,
+        const Real* seg_data, const volatile Long* seg_flag,
+        Real* data, const Int& ndps) const {
+  while (seg_flag[seg_os] != seq_) MPI_Win_sync(win_);
+  MPI_Win_sync(win_);
+  std::copy(seg_data + seg_os*ndps, seg_data + (seg_os + sz)*ndps, data + os*ndps);
+}
+
+void SharedMemoryMessages::l2r_send_to_parents (const Int& lvlidx,
+                                                const Real* l2r_data) const {
+  const auto& lvl = ns_->levels[lvlidx];
+  for (size_t i = 0; i < lvl.me.size(); ++i)
+    if (msgs_[lvlidx].me[i].local)
+      send(lvl.me[i].offset, lvl.me[i].size, l2r_data, l2rndps_,
+           my_seg_.l2r_data, my_seg_.l2r_flag);
+}
+
+void SharedMemoryMessages::l2r_recv (const Int& lvlidx, Real* l2r_data) const {
+  const auto& lvl = ns_->levels[lvlidx];
+  for (size_t i = 0; i < lvl.kids.size(); ++i) {
+    const auto& m = msgs_[lvlidx].kids[i];
+    if (m.local)
+      recv(m.offset, lvl.kids[i].offset, lvl.kids[i].size, m.seg.l2r_data,
+           m.seg.l2r_flag, l2r_data, l2rndps_);
+  }
+}
+
+void SharedMemoryMessages::r2l_send_to_kids (const Int& lvlidx,
+                                             const Real* r2l_data) const {
+  const auto& lvl = ns_->levels[lvlidx];
+  for (size_t i = 0; i < lvl.kids.size(); ++i)
+    if (msgs_[lvlidx].kids[i].local)
+      send(lvl.kids[i].offset, lvl.kids[i].size, r2l_data, r2lndps_,
+           my_seg_.r2l_data, my_seg_.r2l_flag);
+}
+
+void SharedMemoryMessages::r2l_recv (const Int& lvlidx, Real* r2l_data) const {
+  const auto& lvl = ns_->levels[lvlidx];
+  for (size_t i = 0; i < lvl.me.size(); ++i) {
+    const auto& m = msgs_[lvlidx].me[i];
+    if (m.local)
+      recv(m.offset, lvl.me[i].offset, lvl.me[i].size, m.seg.r2l_data,
+           m.seg.r2l_flag, r2l_data, r2lndps_);
+  }
+}
+
 // Check that the offsets are self consistent.
 Int check_comm (const NodeSets& ns) {
   Int nerr = 0;
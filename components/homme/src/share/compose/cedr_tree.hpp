@@ -120,6 +120,113 @@ typedef NodeSetsDeviceData<Kokkos::DefaultHostExecutionSpace> NodeSetsHostData;
 NodeSets::ConstPtr analyze(const Parallel::Ptr& p, const Int& ncells,
                            const tree::Node::Ptr& tree);
 
+// Map from rank to shared-memory node, where a shared-memory node is the set of
+// ranks in an MPI_Comm_split_type(MPI_COMM_TYPE_SHARED) communicator. The
+// leader of a shared-memory node is its lowest rank.
+struct SharedMemoryNodes {
+  typedef std::shared_ptr<const SharedMemoryNodes> ConstPtr;
+
+  // Split p's communicator by shared memory.
+  SharedMemoryNodes(const Parallel::Ptr& p);
+  // For testing, emulate shared-memory nodes of ranks_per_node contiguous ranks.
+  SharedMemoryNodes(const Parallel::Ptr& p, const Int& ranks_per_node);
+
+  Int nnode () const { return nnode_; }
+  Int leader (const Int& rank) const { return leader_[rank]; }
+  bool same_node (const Int& r0, const Int& r1) const {
+    return leader_[r0] == leader_[r1];
+  }
+
+private:
+  std::vector<Int> leader_;
+  Int nnode_;
+
+  void init_nnode();
+};
+
+// Assign ranks to the non-leaf nodes of a tree, leaving nodes having rank >= 0
+// as they are. A node whose kids are on the same shared-memory node goes to the
+// rank of its first kid, as in analyze. A node joining kids on different
+// shared-memory nodes goes to the leader of its first kid's shared-memory
+// node. Thus, only leaders receive messages from other shared-memory nodes, and
+// every other level runs within a shared-memory node. The tree's structure is
+// unchanged, so QLT results are BFB with those of the default assignment.
+void set_node_aware_ranks(const SharedMemoryNodes& smn, const tree::Node::Ptr& tree);
+
+// Send the messages of a level schedule between ranks on the same shared-memory
+// node through an MPI-3 shared-memory window rather than MPI point-to-point
+// messages. Each rank's segment of the window mirrors its l2r and r2l bulk
+// data, plus a flag per slot. A sender copies its slots into its own segment
+// and sets the flag to the sequence number of the current run; the receiver
+// waits for the flag, then copies the slots from the sender's segment. The
+// level schedule ensures a segment is not rewritten before the receiver has
+// read it: a rank sends l2r data again only after it receives the r2l data that
+// depend on the previous ones, and similarly for r2l.
+//   Bulk data must be in host memory.
+class SharedMemoryMessages {
+public:
+  typedef std::shared_ptr<SharedMemoryMessages> Ptr;
+
+  // Collective on p. l2rndps and r2lndps are the number of data per slot.
+  SharedMemoryMessages(const Parallel::Ptr& p, const NodeSets::ConstPtr& ns,
+                       const Int& l2rndps, const Int& r2lndps);
+  ~SharedMemoryMessages();
+
+  SharedMemoryMessages(const SharedMemoryMessages&) = delete;
+  SharedMemoryMessages& operator=(const SharedMemoryMessages&) = delete;
+
+  // Whether message levels[lvlidx].me[i] (kids[i]) goes through shared memory.
+  bool me_is_local (const Int& lvlidx, const Int& i) const {
+    return msgs_[lvlidx].me[i].local;
+  }
+  bool kid_is_local (const Int& lvlidx, const Int& i) const {
+    return msgs_[lvlidx].kids[i].local;
+  }
+
+  // Call at the start of each run of the level schedule.
+  void start_run () { ++seq_; }
+
+  // Send or receive all the shared-memory messages of level lvlidx.
+  void l2r_send_to_parents(const Int& lvlidx, const Real* l2r_data) const;
+  void l2r_recv(const Int& lvlidx, Real* l2r_data) const;
+  void r2l_send_to_kids(const Int& lvlidx, const Real* r2l_data) const;
+  void r2l_recv(const Int& lvlidx, Real* r2l_data) const;
+
+private:
+  // A rank's segment of the window.
+  struct Segment {
+    volatile Long* l2r_flag, * r2l_flag;
+    Real* l2r_data, * r2l_data;
+  };
+
+  // A message with a comm partner. If local, offset is the partner's offset
+  // to the slots, and seg is the partner's segment.
+  struct Message {
+    bool local;
+    Int offset;
+    Segment seg;
+  };
+
+  struct Level {
+    std::vector<Message> me, kids;
+  };
+
+  const NodeSets::ConstPtr ns_;
+  const Int l2rndps_, r2lndps_;
+  MPI_Comm shm_;
+  MPI_Win win_;
+  Segment my_seg_;
+  std::vector<Level> msgs_;
+  Long seq_;
+
+  Segment get_segment(const Int& shm_rank) const;
+  void send(const Int& os, const Int& sz, const Real* data, const Int& ndps,
+            Real* seg_data, volatile Long* seg_flag) const;
+  void recv(const Int& seg_os, const Int& os, const Int& sz,
+            const Real* seg_data, const volatile Long* seg_flag,
+            Real* data, const Int& ndps) const;
+};
+
 Int unittest(const Parallel::Ptr& p);
 
 // Tree for a 1-D periodic domain, for unit testing.
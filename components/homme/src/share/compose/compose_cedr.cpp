@@ -125,10 +125,14 @@ private:
 // since here we're assigning the ranks ourselves. Similarly, it must
 // check for node->level >= 0; if the tree is partial, it is unable to
 // compute node level.
+//   If smn is provided, non-leaf nodes are assigned to ranks as in
+// cedr::tree::set_node_aware_ranks. A node's rank is then known only after its
+// kids', so the whole tree is traversed before pruning, as in the default case.
 tree::Node::Ptr
 make_my_tree_part (const oned::Mesh& m, const Int cs, const Int ce,
                    const tree::Node* parent,
-                   const Int& nrank, const Int* rank2sfc) {
+                   const Int& nrank, const Int* rank2sfc,
+                   const tree::SharedMemoryNodes* smn) {
   const auto my_rank = m.parallel()->rank();
   const Int cn = ce - cs, cn0 = cn/2;
   tree::Node::Ptr n = std::make_shared<tree::Node>();
@@ -141,8 +145,13 @@ make_my_tree_part (const oned::Mesh& m, const Int cs, const Int ce,
     n->level = 0;
     return n;
   }
-  const auto k1 = make_my_tree_part(m, cs, cs + cn0, n.get(), nrank, rank2sfc);
-  const auto k2 = make_my_tree_part(m, cs + cn0, ce, n.get(), nrank, rank2sfc);
+  const auto k1 = make_my_tree_part(m, cs, cs + cn0, n.get(), nrank, rank2sfc, smn);
+  const auto k2 = make_my_tree_part(m, cs + cn0, ce, n.get(), nrank, rank2sfc, smn);
+  if (smn) {
+    n->rank = k1->rank;
+    if ( ! smn->same_node(k1->rank, k2->rank)) n->rank = smn->leader(k1->rank);
+    n->cellidx = n->rank == my_rank ? cs : -1;
+  }
   n->level = 1 + std::max(k1->level, k2->level);
   if (n->rank == my_rank) {
     // Need to know both kids for comm.
@@ -165,9 +174,10 @@ make_my_tree_part (const oned::Mesh& m, const Int cs, const Int ce,
 
 tree::Node::Ptr
 make_my_tree_part (const cedr::mpi::Parallel::Ptr& p, const Int& ncells,
-                   const Int& nrank, const Int* rank2sfc) {
+                   const Int& nrank, const Int* rank2sfc,
+                   const tree::SharedMemoryNodes* smn) {
   oned::Mesh m(ncells, p);
-  return make_my_tree_part(m, 0, m.ncell(), nullptr, nrank, rank2sfc);
+  return make_my_tree_part(m, 0, m.ncell(), nullptr, nrank, rank2sfc, smn);
 }
 
 static size_t nextpow2 (size_t n) {
@@ -188,9 +198,12 @@ static size_t get_tree_height (size_t nleaf) {
 
 tree::Node::Ptr
 make_tree_sgi (const cedr::mpi::Parallel::Ptr& p, const Int nelem,
-               const Int* owned_ids, const Int* rank2sfc, const Int nsublev) {
+               const Int* owned_ids, const Int* rank2sfc, const Int nsublev,
+               const bool node_aware) {
   // Partition 0:nelem-1, the space-filling curve space.
-  auto tree = make_my_tree_part(p, nelem, p->size(), rank2sfc);
+  std::shared_ptr<tree::SharedMemoryNodes> smn;
+  if (node_aware) smn = std::make_shared<tree::SharedMemoryNodes>(p);
+  auto tree = make_my_tree_part(p, nelem, p->size(), rank2sfc, smn.get());
   // Renumber so that node->cellidx records the global element number, and
   // associate the correct rank with the element.
   const auto my_rank = p->rank();
@@ -310,9 +323,11 @@ tree::Node::Ptr
 make_tree (const cedr::mpi::Parallel::Ptr& p, const Int nelem,
            const Int* gid_data, const Int* rank_data, const Int nsublev,
            const bool use_sgi, const bool cdr_over_super_levels,
-           const Int nsuplev) {
+           const Int nsuplev, const bool node_aware = false) {
+  // In the non-SGI case, the non-leaf nodes' ranks are left unassigned, and QLT
+  // assigns them according to CDR::Options::node_aware_tree.
   auto tree = use_sgi ?
-    make_tree_sgi    (p, nelem, gid_data, rank_data, nsublev) :
+    make_tree_sgi    (p, nelem, gid_data, rank_data, nsublev, node_aware) :
     make_tree_non_sgi(p, nelem, gid_data, rank_data, nsublev);
   Int nleaf = nelem*nsublev;
   if (cdr_over_super_levels) {
@@ -335,6 +350,31 @@ Int test_tree_maker () {
   return nerr;
 }
 
+// Check the node-aware ranks in the partial tree. With nodes of 2 ranks, ranks
+// are on different nodes with p->size() > 2.
+Int check_node_aware_tree_part (const Int my_rank, const tree::SharedMemoryNodes& smn,
+                                const tree::Node::Ptr& n) {
+  Int nerr = 0;
+  if (n->rank == my_rank && n->nkids != 0 && n->nkids != 2) ++nerr;
+  if (n->nkids == 2) {
+    const Int r0 = n->kids[0]->rank, r1 = n->kids[1]->rank;
+    if (n->rank != (smn.same_node(r0, r1) ? r0 : smn.leader(r0))) ++nerr;
+  }
+  for (Int k = 0; k < n->nkids; ++k)
+    nerr += check_node_aware_tree_part(my_rank, smn, n->kids[k]);
+  return nerr;
+}
+
+Int test_node_aware_tree_part (const cedr::mpi::Parallel::Ptr& p) {
+  const Int nrank = p->size(), ncell = 3*nrank + 1;
+  std::vector<Int> rank2sfc(nrank + 1);
+  for (Int r = 0; r < nrank; ++r) rank2sfc[r] = 3*r;
+  rank2sfc[nrank] = ncell;
+  const tree::SharedMemoryNodes smn(p, 2);
+  const auto tree = make_my_tree_part(p, ncell, nrank, rank2sfc.data(), &smn);
+  return check_node_aware_tree_part(p->rank(), smn, tree);
+}
+
 extern "C"
 void compose_repro_sum(const Real* send, Real* recv,
                        Int nlocal, Int nfld, Int fcomm);
@@ -421,7 +461,7 @@ private:
 template <typename MT>
 CDR<MT>::CDR (Int cdr_alg_, Int ngblcell_, Int nlclcell_, Int nlev_, Int qsize_,
               bool use_sgi, bool independent_time_steps, const bool hard_zero_,
-              const Int* gid_data, const Int* rank_data,
+              const bool node_aware, const Int* gid_data, const Int* rank_data,
               const cedr::mpi::Parallel::Ptr& p_, Int fcomm)
   : alg(Alg::convert(cdr_alg_)),
     ncell(ngblcell_), nlclcell(nlclcell_), nlev(nlev_), qsize(qsize_),
@@ -436,11 +476,12 @@ CDR<MT>::CDR (Int cdr_alg_, Int ngblcell_, Int nlclcell_, Int nlev_, Int qsize_,
   const Int n_id_in_suplev = caas_in_suplev ? 1 : nsublev;
   if (Alg::is_qlt(alg)) {
     tree = make_tree(p, ncell, gid_data, rank_data, n_id_in_suplev, use_sgi,
-                     cdr_over_super_levels, nsuplev);
+                     cdr_over_super_levels, nsuplev, node_aware);
     Int nleaf = ncell*n_id_in_suplev;
     if (cdr_over_super_levels) nleaf *= nsuplev;
     cedr::CDR::Options options;
     options.prefer_numerical_mass_conservation_to_numerical_bounds = true;
+    options.node_aware_tree = node_aware;
     cdr = std::make_shared<QLTT>(p, nleaf, tree, options, threed ? nsuplev : 0);
     tree = nullptr;
   } else if (Alg::is_caas(alg)) {
@@ -607,6 +648,9 @@ int cedr_unittest (MPI_Comm mpi_comm) {
   ne = cedr::tree::unittest(p);
   if (ne && p->amroot()) std::cerr << "FAIL: tree::unittest()\n";
   nerr += ne;
+  ne = homme::test_node_aware_tree_part(p);
+  if (ne) std::cerr << "FAIL: homme::test_node_aware_tree_part() on rank " << p->rank() << "\n";
+  nerr += ne;
   ne = cedr::caas::test::unittest(p);
   if (ne && p->amroot()) std::cerr << "FAIL: cedr::caas::test::unittest()\n";
   nerr += ne;
@@ -627,11 +671,11 @@ cedr_init_impl (const homme::Int fcomm, const homme::Int cdr_alg, const bool use
                 const homme::Int gbl_ncell, const homme::Int lcl_ncell,
                 const homme::Int nlev, const homme::Int qsize,
                 const bool independent_time_steps, const bool hard_zero,
-                const homme::Int, const homme::Int) {
+                const bool node_aware, const homme::Int, const homme::Int) {
   const auto p = cedr::mpi::make_parallel(MPI_Comm_f2c(fcomm));
   g_cdr = std::make_shared<homme::CDR<ko::MachineTraits> >(
     cdr_alg, gbl_ncell, lcl_ncell, nlev, qsize, use_sgi,
-    independent_time_steps, hard_zero, gid_data, rank_data, p, fcomm);
+    independent_time_steps, hard_zero, node_aware, gid_data, rank_data, p, fcomm);
 }
 
 extern "C" void cedr_query_bufsz (homme::Int* sendsz, homme::Int* recvsz) {
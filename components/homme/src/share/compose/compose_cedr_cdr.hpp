@@ -68,8 +68,9 @@ struct CDR {
   bool run; // for debugging, it can be useful not to run the CEDR.
 
   CDR(Int cdr_alg_, Int ngblcell_, Int nlclcell_, Int nlev_, Int qsize_, bool use_sgi,
-      bool independent_time_steps, const bool hard_zero_, const Int* gid_data,
-      const Int* rank_data, const cedr::mpi::Parallel::Ptr& p_, Int fcomm);
+      bool independent_time_steps, const bool hard_zero_, const bool node_aware,
+      const Int* gid_data, const Int* rank_data, const cedr::mpi::Parallel::Ptr& p_,
+      Int fcomm);
 
   CDR(const CDR&) = delete;
   CDR& operator=(const CDR&) = delete;
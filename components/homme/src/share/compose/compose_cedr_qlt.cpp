@@ -196,16 +196,12 @@ void QLT<ES>::run () {
 
 template <typename ES>
 void QLT<ES>::runimpl () {
-  static const int mpitag = 42;
   using cedr::Int;
   using cedr::Real;
   using cedr::ProblemType;
-  using cedr::tree::NodeSets;
-  namespace mpi = cedr::mpi;
   auto& md_ = this->o.md_;
   auto& bd_ = this->o.bd_;
   auto& ns_ = this->ns_;
-  auto& p_ = this->p_;
 #if ! defined THREAD_QLT_RUN && defined COMPOSE_HORIZ_OPENMP
 # pragma omp master
   {
@@ -214,6 +210,11 @@ void QLT<ES>::runimpl () {
     const Int l2rndps = md_.a_d.prob2bl2r[md_.nprobtypes];
     const Int r2lndps = md_.a_d.prob2br2l[md_.nprobtypes];
 
+#if defined THREAD_QLT_RUN && defined COMPOSE_HORIZ_OPENMP
+#   pragma omp master
+#endif
+    if (this->smm_) this->smm_->start_run();
+
     // Leaves to root.
     for (size_t il = 0; il < ns_->levels.size(); ++il) {
       auto& lvl = ns_->levels[il];
@@ -223,14 +224,7 @@ void QLT<ES>::runimpl () {
 #if defined THREAD_QLT_RUN && defined COMPOSE_HORIZ_OPENMP
 #       pragma omp master
 #endif
-        {
-          for (size_t i = 0; i < lvl.kids.size(); ++i) {
-            const auto& mmd = lvl.kids[i];
-            mpi::irecv(*p_, &bd_.l2r_data(mmd.offset*l2rndps), mmd.size*l2rndps, mmd.rank,
-                       mpitag, &lvl.kids_req[i]);
-          }
-          mpi::waitall(lvl.kids_req.size(), lvl.kids_req.data());
-        }
+        this->l2r_recv(il, l2rndps);
 #if defined THREAD_QLT_RUN && defined COMPOSE_HORIZ_OPENMP
 #       pragma omp barrier
 #endif
@@ -286,13 +280,7 @@ void QLT<ES>::runimpl () {
 #if defined THREAD_QLT_RUN && defined COMPOSE_HORIZ_OPENMP
 #     pragma omp master
 #endif
-      {
-        for (size_t i = 0; i < lvl.me.size(); ++i) {
-          const auto& mmd = lvl.me[i];
-          mpi::isend(*p_, &bd_.l2r_data(mmd.offset*l2rndps), mmd.size*l2rndps,
-                     mmd.rank, mpitag);
-        }
-      }
+      this->l2r_send_to_parents(il, l2rndps);
 
 #if defined THREAD_QLT_RUN && defined COMPOSE_HORIZ_OPENMP
 #     pragma omp barrier
@@ -347,14 +335,7 @@ void QLT<ES>::runimpl () {
 #if defined THREAD_QLT_RUN && defined COMPOSE_HORIZ_OPENMP
 #       pragma omp master
 #endif
-        {
-          for (size_t i = 0; i < lvl.me.size(); ++i) {
-            const auto& mmd = lvl.me[i];
-            mpi::irecv(*p_, &bd_.r2l_data(mmd.offset*r2lndps), mmd.size*r2lndps, mmd.rank,
-                       mpitag, &lvl.me_recv_req[i]);
-          }
-          mpi::waitall(lvl.me_recv_req.size(), lvl.me_recv_req.data());
-        }
+        this->r2l_recv(il-1, r2lndps);
 #if defined THREAD_QLT_RUN && defined COMPOSE_HORIZ_OPENMP
 #       pragma omp barrier
 #endif
@@ -417,13 +398,7 @@ void QLT<ES>::runimpl () {
 #if defined THREAD_QLT_RUN && defined COMPOSE_HORIZ_OPENMP
 #     pragma omp master
 #endif
-      {
-        for (size_t i = 0; i < lvl.kids.size(); ++i) {
-          const auto& mmd = lvl.kids[i];
-          mpi::isend(*p_, &bd_.r2l_data(mmd.offset*r2lndps), mmd.size*r2lndps,
-                     mmd.rank, mpitag);
-        }
-      }
+      this->r2l_send_to_kids(il-1, r2lndps);
     }
 #if ! defined THREAD_QLT_RUN && defined COMPOSE_HORIZ_OPENMP
   }
@@ -52,7 +52,9 @@ struct ComposeTransportImpl {
   using Buf1 = ExecViewUnmanaged<Scalar*[NP][NP][NUM_LEV_P]>;
   using Buf2 = ExecViewUnmanaged<Scalar*[2][NP][NP][NUM_LEV_P]>;
 
-  using DeparturePoints = ExecViewManaged<Real*[NUM_PHYSICAL_LEV][NP][NP][3]>;
+  // Departure points are needed only from calc_trajectory to the end of
+  // advection, so they live in the FunctorsBuffersManager memory, too.
+  using DeparturePoints = ExecViewUnmanaged<Real*[NUM_PHYSICAL_LEV][NP][NP][3]>;
 
   struct Data {
     int nelemd, qsize, limiter_option, cdr_check, hv_q, hv_subcycle_q;
@@ -79,7 +81,7 @@ struct ComposeTransportImpl {
   ElementsGeometry m_geometry;
   Tracers m_tracers;
   SphereOperators m_sphere_ops;
-  int nslot;
+  int nelem, nslot;
   Data m_data;
 
   TeamPolicy m_tp_ne, m_tp_ne_qsize, m_tp_ne_hv_q;
@@ -99,6 +101,7 @@ struct ComposeTransportImpl {
   }
 
   void set_dp_tol();
+  void set_compose_views();
   void reset(const SimulationParams& params);
   int requested_buffer_size() const;
   void init_buffers(const FunctorsBuffersManager& fbm);
@@ -33,7 +33,9 @@ ComposeTransportImpl::ComposeTransportImpl (const int num_elems)
   : m_tp_ne(1,1,1), m_tp_ne_qsize(1,1,1), m_tp_ne_hv_q(1,1,1), // throwaway settings
     m_tu_ne(m_tp_ne), m_tu_ne_qsize(m_tp_ne_qsize), m_tu_ne_hv_q(m_tp_ne_hv_q)
 {
-  nslot = calc_nslot(m_geometry.num_elems());
+  // The geometry is not available yet, but the buffer size must be.
+  nelem = num_elems;
+  nslot = calc_nslot(nelem);
 }
 
 void ComposeTransportImpl::setup () {
@@ -46,39 +48,44 @@ void ComposeTransportImpl::setup () {
   m_sphere_ops = Context::singleton().get<SphereOperators>();
   
   set_dp_tol();
-  nslot = calc_nslot(m_geometry.num_elems());
+  nelem = m_geometry.num_elems();
+  nslot = calc_nslot(nelem);
+}
+
+void ComposeTransportImpl::set_compose_views () {
+  const auto& g = m_geometry;
+  const auto& t = m_tracers;
+  const auto& s = m_state;
+  const auto& d = m_derived;
+  const auto nel = Context::singleton().get<Connectivity>().get_num_local_elements();
+  const auto nlev = NUM_LEV*packn;
+  const bool independent_time_steps = m_data.independent_time_steps;
+  homme::compose::set_views(
+    g.m_spheremp,
+    homme::compose::SetView<Real****>  (reinterpret_cast<Real*>(d.m_dp.data()),
+                                        nel, np, np, nlev),
+    homme::compose::SetView<Real*****> (
+      reinterpret_cast<Real*>(independent_time_steps ?
+                              d.m_divdp.data() :
+                              s.m_dp3d.data()),
+      nel, (independent_time_steps ? 1 : NUM_TIME_LEVELS), np, np, nlev),
+    homme::compose::SetView<Real******>(
+      reinterpret_cast<Real*>(t.qdp.data()),
+      nel, t.qdp.extent_int(1), t.qdp.extent_int(2), np, np, nlev),
+    homme::compose::SetView<Real*****> (reinterpret_cast<Real*>(t.Q.data()),
+                                        nel, t.Q.extent_int(1), np, np, nlev),
+    m_data.dep_pts);
 }
 
 void ComposeTransportImpl::reset (const SimulationParams& params) {
   const auto num_elems = Context::singleton().get<Connectivity>().get_num_local_elements();
 
   const bool independent_time_steps = params.dt_tracer_factor > params.dt_remap_factor;
-  if (independent_time_steps != m_data.independent_time_steps ||
-      m_data.nelemd != num_elems || m_data.qsize != params.qsize) {
-    const auto& g = m_geometry;
-    const auto& t = m_tracers;
-    const auto& s = m_state;
-    const auto& d = m_derived;
-    const auto nel = num_elems;
-    const auto nlev = NUM_LEV*packn;
-    m_data.dep_pts = DeparturePoints("dep_pts", nel);
-    homme::compose::set_views(
-      g.m_spheremp,
-      homme::compose::SetView<Real****>  (reinterpret_cast<Real*>(d.m_dp.data()),
-                                          nel, np, np, nlev),
-      homme::compose::SetView<Real*****> (
-        reinterpret_cast<Real*>(independent_time_steps ?
-                                d.m_divdp.data() :
-                                s.m_dp3d.data()),
-        nel, (independent_time_steps ? 1 : NUM_TIME_LEVELS), np, np, nlev),
-      homme::compose::SetView<Real******>(
-        reinterpret_cast<Real*>(t.qdp.data()),
-        nel, t.qdp.extent_int(1), t.qdp.extent_int(2), np, np, nlev),
-      homme::compose::SetView<Real*****> (reinterpret_cast<Real*>(t.Q.data()),
-                                          nel, t.Q.extent_int(1), np, np, nlev),
-      m_data.dep_pts);
-  }
+  const bool views_changed = (independent_time_steps != m_data.independent_time_steps ||
+                               m_data.nelemd != num_elems || m_data.qsize != params.qsize);
   m_data.independent_time_steps = independent_time_steps;
+  // If init_buffers has not been called yet, it will set the views.
+  if (views_changed && m_data.dep_pts.data()) set_compose_views();
   if (m_data.nelemd == num_elems && m_data.qsize == params.qsize) return;
 
   m_data.qsize = params.qsize;
@@ -114,7 +121,8 @@ void ComposeTransportImpl::reset (const SimulationParams& params) {
 int ComposeTransportImpl::requested_buffer_size () const {
   // FunctorsBuffersManager wants the size in terms of sizeof(Real).
   return (3*Buf1::shmem_size(nslot) +
-          2*Buf2::shmem_size(nslot))/sizeof(Real);
+          2*Buf2::shmem_size(nslot) +
+          DeparturePoints::shmem_size(nelem))/sizeof(Real);
 }
 
 void ComposeTransportImpl::init_buffers (const FunctorsBuffersManager& fbm) {
@@ -127,6 +135,9 @@ void ComposeTransportImpl::init_buffers (const FunctorsBuffersManager& fbm) {
     m_data.buf2[i] = Buf2(mem, nslot);
     mem += Buf2::shmem_size(nslot)/sizeof(Scalar);
   }
+  m_data.dep_pts = DeparturePoints(reinterpret_cast<Real*>(mem), nelem);
+  // If reset has already been called, the compose views need the new memory.
+  if (m_data.nelemd > 0) set_compose_views();
 }
 
 void ComposeTransportImpl::init_boundary_exchanges () {
@@ -187,10 +198,12 @@ void ComposeTransportImpl::run (const TimeLevel& tl, const Real dt) {
   homme::compose::advect(tl.np1, tl.n0_qdp, tl.np1_qdp);
   GPTLstop("compose_isl");
   
+  // Note: the kernels below are all launched in the same execution space
+  // instance, so they need no fences in between. The CEDR global pass and the
+  // boundary exchange fence before they touch the data on host (MPI).
   if (m_data.hv_q > 0 && m_data.nu_q > 0) {
     GPTLstart("compose_hypervis_scalar");
     advance_hypervis_scalar(dt);
-    Kokkos::fence();
     GPTLstop("compose_hypervis_scalar");
   }
   
@@ -199,12 +212,10 @@ void ComposeTransportImpl::run (const TimeLevel& tl, const Real dt) {
                                0 : // dp3d is actually divdp
                                tl.np1);
   const auto run_cedr = homme::compose::property_preserve_global();
-  if (run_cedr) Kokkos::fence();
   GPTLstop("compose_cedr_global");
   GPTLstart("compose_cedr_local");
   if (run_cedr) {
     homme::compose::property_preserve_local(m_data.limiter_option);
-    Kokkos::fence();
   }
   GPTLstop("compose_cedr_local");    
 
@@ -227,25 +238,10 @@ void ComposeTransportImpl::run (const TimeLevel& tl, const Real dt) {
     launch_ie_q_ij_nlev<num_lev_pack>(qsize, f);
   }
   
-  { // DSS qdp and omega
+  { // DSS qdp and omega. The spheremp weighting is done by the boundary
+    // exchange while packing and unpacking, to save two passes over the fields.
     GPTLstart("compose_dss_q");
-    const auto qdp = m_tracers.qdp;
-    const auto spheremp = m_geometry.m_spheremp;
-    const auto f1 = KOKKOS_LAMBDA (const int idx) {
-      int ie, q, i, j, lev;
-      idx_ie_q_ij_nlev<num_lev_pack>(qsize, idx, ie, q, i, j, lev);
-      qdp(ie,np1_qdp,q,i,j,lev) *= spheremp(ie,i,j);
-    };
-    launch_ie_q_ij_nlev<num_lev_pack>(qsize, f1);
-    const auto omega = m_derived.m_omega_p;
-    const auto f2 = KOKKOS_LAMBDA (const int idx) {
-      int ie, i, j, lev;
-      idx_ie_ij_nlev<num_lev_pack>(idx, ie, i, j, lev);
-      omega(ie,i,j,lev) *= spheremp(ie,i,j);
-    };
-    launch_ie_ij_nlev<num_lev_pack>(f2);
-    m_qdp_dss_be[tl.np1_qdp]->exchange(m_geometry.m_rspheremp);
-    Kokkos::fence();
+    m_qdp_dss_be[tl.np1_qdp]->exchange(m_geometry.m_spheremp, m_geometry.m_rspheremp);
     GPTLstop("compose_dss_q");
   }
   
@@ -368,22 +368,26 @@ void ComposeTransportImpl::calc_trajectory (const int np1, const Real dt) {
     const auto m_dp3d = m_state.m_dp3d;
     const auto m_dp = m_derived.m_dp;
     const auto m_divdp = m_derived.m_divdp;
+    // Note: all kernels in this function run in the same execution space
+    // instance, so they need no fences in between. The boundary exchange
+    // fences before using the data for MPI and after unpacking.
     if (m_data.independent_time_steps) {
       GPTLstart("compose_3d_levels");
-      const auto copy_v = KOKKOS_LAMBDA (const int idx) {
-        int ie, lev, i, j;
-        cti::idx_ie_packlev_ij(idx, ie, lev, i, j);
-        for (int d = 0; d < 2; ++d)
-          m_vn0(ie,d,i,j,lev) = m_v(ie,np1,d,i,j,lev);
-      };
-      launch_ie_packlev_ij(copy_v);
-      Kokkos::fence();
       const auto calc_dprecon = KOKKOS_LAMBDA (const MT& team) {
         KernelVariables kv(team, tu_ne);
         const auto ie = kv.ie;
         const auto vn0 = Homme::subview(m_vn0, ie);
         const auto vstar = Homme::subview(m_vstar, ie);
         const auto dprecon = Homme::subview(m_divdp, ie);
+        {
+          const auto v = Homme::subview(m_v, ie, np1);
+          const auto f = [&] (const int i, const int j, const int k) {
+            for (int d = 0; d < 2; ++d)
+              vn0(d,i,j,k) = v(d,i,j,k);
+          };
+          cti::loop_ijk<num_lev_pack>(kv, f);
+        }
+        kv.team_barrier();
         calc_vertically_lagrangian_levels(
           sphere_ops, kv, ps0, hybrid_ai0, hybrid_bi,
           Homme::subview(m_dp3d, ie, np1), Homme::subview(m_dp, ie),
@@ -393,22 +397,7 @@ void ComposeTransportImpl::calc_trajectory (const int np1, const Real dt) {
           dprecon);
       };
       Kokkos::parallel_for(m_tp_ne, calc_dprecon);
-      Kokkos::fence();
       remap_v(m_dp3d, np1, m_divdp, m_vn0);
-      const auto sphere = KOKKOS_LAMBDA (const MT& team) {
-        KernelVariables kv(team, tu_ne);
-        const auto ie = kv.ie;
-        const auto spheremp = Homme::subview(m_spheremp, ie);
-        const auto rspheremp = Homme::subview(m_rspheremp, ie);
-        const auto f = [&] (const int i, const int j, const int kp) {
-          const auto dprecon = Homme::subview(m_divdp, ie);
-          dprecon(i,j,kp) = dprecon(i,j,kp)*spheremp(i,j)*rspheremp(i,j);
-        };
-        cti::loop_ijk<num_lev_pack>(kv, f);
-      };
-      Kokkos::fence();
-      Kokkos::parallel_for(m_tp_ne, sphere);
-      Kokkos::fence();
       GPTLstop("compose_3d_levels");
     }
     GPTLstart("compose_v_bexchv");
@@ -419,6 +408,7 @@ void ComposeTransportImpl::calc_trajectory (const int np1, const Real dt) {
                         Homme::subview(m_vn0, ie) :
                         Homme::subview(m_v, ie, np1));
       const auto vstar = Homme::subview(m_vstar, ie);
+      const auto dprecon = Homme::subview(m_divdp, ie);
       const auto spheremp = Homme::subview(m_spheremp, ie);
       const auto rspheremp = Homme::subview(m_rspheremp, ie);
       const auto ugradv = S2Nlev(Homme::subview(buf2b, kv.team_idx).data());
@@ -426,21 +416,22 @@ void ComposeTransportImpl::calc_trajectory (const int np1, const Real dt) {
                     SNlev(Homme::subview(buf1a, kv.team_idx).data()),
                     S2Nlev(Homme::subview(buf2a, kv.team_idx).data()),
                     ugradv);
-      // Write the midpoint velocity to vstar.
+      // Write the midpoint velocity to vstar. Also prepare dprecon for the
+      // DSS, which is exchanged together with vstar.
       const auto f = [&] (const int i, const int j, const int k) {
         for (int d = 0; d < 2; ++d)
           vstar(d,i,j,k) = (((vn0(d,i,j,k) + vstar(d,i,j,k))/2 - dt*ugradv(d,i,j,k)/2)*
                             spheremp(i,j)*rspheremp(i,j));
+        if (independent_time_steps)
+          dprecon(i,j,k) = dprecon(i,j,k)*spheremp(i,j)*rspheremp(i,j);
       };
       cti::loop_ijk<num_lev_pack>(kv, f);
     };
     Kokkos::parallel_for(m_tp_ne, calc_midpoint_velocity);
   }
   { // DSS velocity.
-    Kokkos::fence();
     const auto be = m_v_dss_be[m_data.independent_time_steps ? 1 : 0];
     be->exchange();
-    Kokkos::fence();
   }
   GPTLstop("compose_v_bexchv");
   { // Calculate departure point.
@@ -6,6 +6,9 @@
 
 #include "FunctorsBuffersManager.hpp"
 #include "ErrorDefs.hpp"
+
+#include <cstdio>
+
 #ifdef HOMMEXX_BFB_TESTING
 #include "utilities/TestUtils.hpp"
 #include <random>
@@ -19,8 +22,27 @@ FunctorsBuffersManager::FunctorsBuffersManager ()
   m_allocated = false;
 }
 
-void FunctorsBuffersManager::request_size (const int num_doubles) {
+void FunctorsBuffersManager::request_size (const int num_doubles, const std::string& name) {
   m_size = std::max(num_doubles, m_size);
+
+  if (name.empty()) return;
+  for (auto& r : m_requests) {
+    if (r.first==name) {
+      r.second = std::max(num_doubles, r.second);
+      return;
+    }
+  }
+  m_requests.emplace_back(name, num_doubles);
+}
+
+void FunctorsBuffersManager::print_requests () const {
+  constexpr double mb = 1024.0*1024.0;
+  for (const auto& r : m_requests) {
+    printf("hommexx> functors buffer: %-16s %10.2f MB\n",
+           r.first.c_str(), r.second*sizeof(Real)/mb);
+  }
+  printf("hommexx> functors buffer: %-16s %10.2f MB\n",
+         "peak (allocated)", m_size*sizeof(Real)/mb);
 }
 
 void FunctorsBuffersManager:: allocate () {
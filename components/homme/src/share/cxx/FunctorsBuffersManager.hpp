@@ -9,15 +9,31 @@
 
 #include "Types.hpp"
 
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace Homme {
 
 // Elements-dependent buffers.
+// The functors run one at a time in each phase of the time step (caar,
+// hyperviscosity, transport, remap, ...), and none of them needs its buffers
+// to persist outside of its own phase. Hence, all of them carve their buffers
+// starting from the beginning of the same memory, and the allocated size is
+// the max of the requested sizes, rather than their sum. A functor that wants
+// to share memory this way must not expect its buffers' content to survive
+// a call to another functor.
 struct FunctorsBuffersManager {
 
   FunctorsBuffersManager();
   ~FunctorsBuffersManager() = default;
 
-  void request_size (const int num_doubles);
+  // If a name is given, the request is recorded, so that the size needed
+  // by each phase can be reported with print_requests.
+  void request_size (const int num_doubles, const std::string& name = "");
+
+  // Print the size requested by each named phase, and the allocated size.
+  void print_requests () const;
 
   Real* get_memory () const { return m_buffer.data(); }
 
@@ -38,6 +54,8 @@ protected:
   int   m_size;
   bool  m_allocated;
 
+  std::vector<std::pair<std::string,int>> m_requests;
+
 private:
 
   void generate_random_data();
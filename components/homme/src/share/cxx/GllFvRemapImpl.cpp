@@ -29,17 +29,38 @@ typedef ExecViewUnmanaged<Real***> evur3;
 typedef ExecViewUnmanaged<const Real*  > evucr1;
 typedef ExecViewUnmanaged<const Real** > evucr2;
 
-static int calc_nslot (const int nelemd, const int nq) {
-  const int n = nelemd*nq;
-  const auto tp = Homme::get_default_team_policy<ExecSpace>(n);
+static int calc_nslot (const int nelemd) {
+  const auto tp = Homme::get_default_team_policy<ExecSpace>(nelemd);
   const auto tu = TeamUtils<ExecSpace>(tp);
-  return std::min(n, tu.get_num_ws_slots());
+  return std::min(nelemd, tu.get_num_ws_slots());
+}
+
+// All kernels run one team per element, and each team applies the remap
+// operators to the state and to every tracer of its element. Thus, copy the
+// operators to team scratch once per team.
+typedef ScratchView<Real**> remapd_scratch;
+
+static GllFvRemapImpl::TeamPolicy
+get_tp_ne_remapd (const GllFvRemapImpl::TeamPolicy& tp_ne, const int nf2, const int nop) {
+  auto tp = tp_ne;
+  tp.set_scratch_size(0, Kokkos::PerTeam(nop*remapd_scratch::shmem_size(nf2, NP*NP)));
+  return tp;
+}
+
+template <typename AT>
+static KOKKOS_FUNCTION remapd_scratch
+remapd_to_scratch (const KernelVariables& kv, const AT& A) {
+  const int m = A.extent_int(0), n = A.extent_int(1);
+  const remapd_scratch As(kv.team.team_scratch(0), m, n);
+  Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, m*n), [&] (const int idx) {
+    As(idx / n, idx % n) = A(idx / n, idx % n);
+  });
+  return As;
 }
 
 GllFvRemapImpl::GllFvRemapImpl ()
   : // throwaway settings
-    m_tp_ne(1,1,1), m_tp_ne_qsize(1,1,1), m_tp_ne_dss(1,1,1),
-    m_tu_ne(m_tp_ne), m_tu_ne_qsize(m_tp_ne_qsize), m_tu_ne_dss(m_tp_ne_dss)
+    m_tp_ne(1,1,1), m_tu_ne(m_tp_ne)
 {
   setup();
 }
@@ -66,11 +87,7 @@ void GllFvRemapImpl::reset (const SimulationParams& params) {
   m_data.n_dss_fld = m_data.qsize + 2 + 1;
 
   m_tp_ne = Homme::get_default_team_policy<ExecSpace>(m_data.nelemd);
-  m_tp_ne_qsize = Homme::get_default_team_policy<ExecSpace>(m_data.nelemd * m_data.qsize);
-  m_tp_ne_dss = Homme::get_default_team_policy<ExecSpace>(m_data.nelemd * m_data.n_dss_fld);
   m_tu_ne = TeamUtils<ExecSpace>(m_tp_ne);
-  m_tu_ne_qsize = TeamUtils<ExecSpace>(m_tp_ne_qsize);
-  m_tu_ne_dss = TeamUtils<ExecSpace>(m_tp_ne_dss);
 
   if (Context::singleton().get<Connectivity>().get_comm().root())
     printf("gfr> nelemd %d qsize %d\n", m_data.nelemd, m_data.qsize);
@@ -78,14 +95,14 @@ void GllFvRemapImpl::reset (const SimulationParams& params) {
 
 int GllFvRemapImpl::requested_buffer_size () const {
   // FunctorsBuffersManager wants the size in terms of sizeof(Real).
-  const int nslot = calc_nslot(m_tracers.num_elems(), m_tracers.num_tracers());
+  const int nslot = calc_nslot(m_tracers.num_elems());
   return (Data::nbuf1*Buf1::shmem_size(nslot) +
           Data::nbuf2*Buf2::shmem_size(nslot))/sizeof(Real);
 }
 
 void GllFvRemapImpl::init_buffers (const FunctorsBuffersManager& fbm) {
   Scalar* mem = reinterpret_cast<Scalar*>(fbm.get_memory());
-  const int nslot = calc_nslot(m_tracers.num_elems(), m_tracers.num_tracers());
+  const int nslot = calc_nslot(m_tracers.num_elems());
   for (int i = 0; i < Data::nbuf1; ++i) {
     m_data.buf1[i] = Buf1(mem, nslot);
     mem += Buf1::shmem_size(nslot)/sizeof(Scalar);
@@ -388,10 +405,10 @@ void GllFvRemapImpl
   const auto gll_metdet = m_geometry.m_metdet;
   const auto fv_metdet = m_data.fv_metdet;
   const auto w_ff = m_data.w_ff;
-  const auto g2f_remapd = m_data.g2f_remapd;
+  const auto g2f_remapd_g = m_data.g2f_remapd;
   const auto Dinv = m_data.Dinv;
   const auto D_f = m_data.D_f;
-  const auto dp_fv = m_derived.m_divdp_proj; // store dp_fv between kernels
+  const auto dp_fv = m_derived.m_divdp_proj; // store dp_fv for the tracers
   const auto hvcoord = m_hvcoord;
   
   const bool use_moisture = m_data.use_moisture;
@@ -426,6 +443,9 @@ void GllFvRemapImpl
     const evucr1 fv_metdet_ie(&fv_metdet(ie,0), nf2),
       gll_metdet_ie(&gll_metdet(ie,0,0), np2);
 
+    const auto g2f_remapd = remapd_to_scratch(kv, g2f_remapd_g);
+    kv.team_barrier();
+
     // ps and dp_fv
     const evus2 dp_fv_ie(&dp_fv(ie,0,0,0), nf2, nlevpk); {
       const evur2 ps_v_ie(&ps_v(ie,timeidx,0,0), np2, 1), wrk(rw1s.data(), np2, 1);
@@ -527,33 +547,20 @@ void GllFvRemapImpl
     remapd(team, nf2, np2, nlevpk, g2f_remapd, gll_metdet_ie, w_ff, fv_metdet_ie,
            evucs_np2_nlev(&omega_g(ie,0,0,0)), evus_np2_nlev(rw1.data()),
            evus2(&omega(ie,0,0), nf2, nlevpk));
-  };
-  Kokkos::fence();
-  Kokkos::parallel_for(m_tp_ne, fe);
-
-  const auto dp_g = m_state.m_dp3d;
-  const auto tu_ne_qsize = m_tu_ne_qsize;
-  const auto feq = KOKKOS_LAMBDA (const MT& team) {
-    KernelVariables kv(team, qsize, tu_ne_qsize);
-    const auto ie = kv.ie, iq = kv.iq;
 
-    const auto all = Kokkos::ALL();
-    const auto rw1 = Kokkos::subview(buf10, kv.team_idx, all, all, all);
-    const auto rw2 = Kokkos::subview(buf11, kv.team_idx, all, all, all);
-
-    const evucr1 fv_metdet_ie(&fv_metdet(ie,0), nf2),
-      gll_metdet_ie(&gll_metdet(ie,0,0), np2);
-    const EVU<const Scalar**> dp_fv_ie(&dp_fv(ie,0,0,0), nf2, nlevpk);
-    
     // q
-    g2f_mixing_ratio(
-      kv, np2, nf2, nlevpk, g2f_remapd, gll_metdet_ie, w_ff, fv_metdet_ie,
-      evucs_np2_nlev(&dp_g(ie,timeidx,0,0,0)), dp_fv_ie, evucs_np2_nlev(&q_g(ie,iq,0,0,0)),
-      evus_np2_nlev(rw1.data()), evus_np2_nlev(rw2.data()), iq,
-      evus3(&q(ie,0,0,0), q.extent_int(1), q.extent_int(2), q.extent_int(3)));
+    const evucs_np2_nlev dp_g_ie(&dp3d(ie,timeidx,0,0,0));
+    const evus3 q_ie(&q(ie,0,0,0), q.extent_int(1), q.extent_int(2), q.extent_int(3));
+    for (int iq = 0; iq < qsize; ++iq) {
+      kv.team_barrier();
+      g2f_mixing_ratio(
+        kv, np2, nf2, nlevpk, g2f_remapd, gll_metdet_ie, w_ff, fv_metdet_ie,
+        dp_g_ie, dp_fv_ie, evucs_np2_nlev(&q_g(ie,iq,0,0,0)),
+        evus_np2_nlev(rw1.data()), evus_np2_nlev(rw2.data()), iq, q_ie);
+    }
   };
   Kokkos::fence();
-  Kokkos::parallel_for(m_tp_ne_qsize, feq);
+  Kokkos::parallel_for(get_tp_ne_remapd(m_tp_ne, nf2, 1), fe);
 #endif
 }
 
@@ -591,14 +598,14 @@ run_fv_phys_to_dyn (const int timeidx, const CPhys2T& Ts, const CPhys3T& uvs,
     q(creal2pack(qs), qs.extent_int(0), qs.extent_int(1), qs.extent_int(2),
       qs.extent_int(3)/packn);
 
-  const auto dp_fv = m_derived.m_divdp_proj; // store dp_fv between kernels
+  const auto dp_fv = m_derived.m_divdp_proj; // store dp_fv for the tracers
   const auto ps_v = m_state.m_ps_v;
   const auto gll_metdet = m_geometry.m_metdet;
   const auto gll_spheremp = m_geometry.m_spheremp;
   const auto w_ff = m_data.w_ff;
   const auto fv_metdet = m_data.fv_metdet;
-  const auto g2f_remapd = m_data.g2f_remapd;
-  const auto f2g_remapd = m_data.f2g_remapd;
+  const auto g2f_remapd_g = m_data.g2f_remapd;
+  const auto f2g_remapd_g = m_data.f2g_remapd;
   const auto fm = m_forcing.m_fm;
   const auto Dinv_f = m_data.Dinv_f;
   const auto D_g = m_data.D;
@@ -608,6 +615,10 @@ run_fv_phys_to_dyn (const int timeidx, const CPhys2T& Ts, const CPhys3T& uvs,
   const bool theta_hydrostatic_mode = m_data.theta_hydrostatic_mode;
   EquationOfState eos; eos.init(theta_hydrostatic_mode, hvcoord);
   ElementOps ops; ops.init(hvcoord);
+  const auto dp_g = m_state.m_dp3d;
+  const auto q_g = m_tracers.Q;
+  const auto fq = m_tracers.fq;
+  const auto qlim = m_tracers.qlim;
   const auto tu_ne = m_tu_ne;
 
   const auto fe = KOKKOS_LAMBDA (const MT& team) {
@@ -620,12 +631,17 @@ run_fv_phys_to_dyn (const int timeidx, const CPhys2T& Ts, const CPhys3T& uvs,
 
     const auto all = Kokkos::ALL();
     const auto rw1 = Kokkos::subview(buf10, kv.team_idx, all, all, all);
+    const auto rw2 = Kokkos::subview(buf11, kv.team_idx, all, all, all);
     const auto r2w = Kokkos::subview(buf20, kv.team_idx, all, all, all, all);
     const EVU<Real*> rw1s(pack2real(rw1), nreal_per_slot1);
     
     const evucr1 fv_metdet_ie(&fv_metdet(ie,0), nf2),
       gll_metdet_ie(&gll_metdet(ie,0,0), np2);
 
+    const auto g2f_remapd = remapd_to_scratch(kv, g2f_remapd_g);
+    const auto f2g_remapd = remapd_to_scratch(kv, f2g_remapd_g);
+    kv.team_barrier();
+
     // ps and dp_fv
     const evus2 dp_fv_ie(&dp_fv(ie,0,0,0), nf2, nlevpk); {
       const evur2 ps_v_ie(&ps_v(ie,timeidx,0,0), np2, 1), w1(rw1s.data(), np2, 1);
@@ -695,33 +711,10 @@ run_fv_phys_to_dyn (const int timeidx, const CPhys2T& Ts, const CPhys3T& uvs,
       };
       parallel_for(ttrg, f2);
     }
-  };
-  Kokkos::fence();
-  parallel_for(m_tp_ne, fe);
-
-  const auto dp_g = m_state.m_dp3d;
-  const auto q_g = m_tracers.Q;
-  const auto fq = m_tracers.fq;
-  const auto qlim = m_tracers.qlim;
-  const auto tu_ne_qsize = m_tu_ne_qsize;
-
-  const auto feq = KOKKOS_LAMBDA (const MT& team) {
-    KernelVariables kv(team, qsize, tu_ne_qsize);
-    const auto ie = kv.ie, iq = kv.iq;
-    const auto ttrf = Kokkos::TeamThreadRange(kv.team, nf2);
-    const auto ttrg = Kokkos::TeamThreadRange(kv.team, np2);
-    const auto tvr  = Kokkos::ThreadVectorRange(kv.team, nlevpk);
-    const auto all  = Kokkos::ALL();
 
-    const auto rw1 = Kokkos::subview(buf10, kv.team_idx, all, all, all);
-    const auto rw2 = Kokkos::subview(buf11, kv.team_idx, all, all, all);
-    const auto r2w = Kokkos::subview(buf20, kv.team_idx, all, all, all, all);
-
-    const evucr1 fv_metdet_ie(&fv_metdet(ie,0), nf2),
-      gll_metdet_ie(&gll_metdet(ie,0,0), np2);
-    const EVU<const Scalar**> dp_fv_ie(&dp_fv(ie,0,0,0), nf2, nlevpk);
-
-    {
+    // q
+    for (int iq = 0; iq < qsize; ++iq) {
+      kv.team_barrier();
       // Get limiter bounds.
       const evus2 qf_ie(&r2w(1,0,0,0), nf2, nlevpk);
       loop_ik(ttrf, tvr, [&] (int i, int k) { qf_ie(i,k) = q(ie,i,iq,k); });
@@ -753,58 +746,41 @@ run_fv_phys_to_dyn (const int timeidx, const CPhys2T& Ts, const CPhys3T& uvs,
     }
   };
   Kokkos::fence();
-  parallel_for(m_tp_ne_qsize, feq);
+  parallel_for(get_tp_ne_remapd(m_tp_ne, nf2, 2), fe);
 
   // Halo exchange extrema data.
   m_extrema_be->exchange_min_max();
 
   const auto geq = KOKKOS_LAMBDA (const MT& team) {
-    KernelVariables kv(team, qsize, tu_ne_qsize);
-    const auto ie = kv.ie, iq = kv.iq;
+    KernelVariables kv(team, tu_ne);
+    const auto ie = kv.ie;
     const auto all = Kokkos::ALL();
     const auto rw1 = Kokkos::subview(buf10, kv.team_idx, all, all, all);
-    // Augment bounds with GLL Q0 bounds. This assures that if the tendency is
-    // 0, GLL Q1 = GLL Q0.
-    const evucs_np2_nlev qg_ie(&q_g(ie,iq,0,0,0));
-    const evus1 qmin(&qlim(ie,iq,0,0), nlevpk), qmax(&qlim(ie,iq,1,0), nlevpk);
-    augment_extrema(kv, np2, nlevpk, qg_ie, qmin, qmax);
-    kv.team_barrier();
-    // Final GLL Q1, except for DSS.
     const evucr1 gll_spheremp_ie(&gll_spheremp(ie,0,0), np2);
     const evucs_np2_nlev dp_g_ie(&dp_g(ie,timeidx,0,0,0));
-    const evus_np2_nlev fq_ie(&fq(ie,iq,0,0,0));
-    limiter_clip_and_sum(kv.team, np2, nlevpk, 1, gll_spheremp_ie, qmin, qmax, dp_g_ie,
-                         evus_np2_nlev(rw1.data()), fq_ie);
+    for (int iq = 0; iq < qsize; ++iq) {
+      kv.team_barrier();
+      // Augment bounds with GLL Q0 bounds. This assures that if the tendency is
+      // 0, GLL Q1 = GLL Q0.
+      const evucs_np2_nlev qg_ie(&q_g(ie,iq,0,0,0));
+      const evus1 qmin(&qlim(ie,iq,0,0), nlevpk), qmax(&qlim(ie,iq,1,0), nlevpk);
+      augment_extrema(kv, np2, nlevpk, qg_ie, qmin, qmax);
+      kv.team_barrier();
+      // Final GLL Q1, except for DSS.
+      const evus_np2_nlev fq_ie(&fq(ie,iq,0,0,0));
+      limiter_clip_and_sum(kv.team, np2, nlevpk, 1, gll_spheremp_ie, qmin, qmax, dp_g_ie,
+                           evus_np2_nlev(rw1.data()), fq_ie);
+    }
   };
   Kokkos::fence();
-  parallel_for(m_tp_ne_qsize, geq);
+  parallel_for(m_tp_ne, geq);
 #endif
 }
 
 void GllFvRemapImpl::run_fv_phys_to_dyn_dss () {
-  const int np2 = GllFvRemapImpl::np2;
-  const int nlevpk = num_lev_pack;
-  const int n_dss_fld = m_data.n_dss_fld;
-  const int qsize = m_data.qsize;
-  const auto gll_spheremp = m_geometry.m_spheremp;
-  const auto fq = m_tracers.fq;
-  const auto fm = m_forcing.m_fm;
-  const auto ft = m_forcing.m_ft;
-  const auto f = KOKKOS_LAMBDA (const MT& team) {
-    const int ie  = team.league_rank() / n_dss_fld;
-    const int idx = team.league_rank() % n_dss_fld;
-    const auto ttrg = Kokkos::TeamThreadRange(team, np2);
-    const auto tvr  = Kokkos::ThreadVectorRange(team, nlevpk);
-    const evucr1 s(&gll_spheremp(ie,0,0), np2);
-    const evus2 f_ie((idx  < qsize     ? &fq(ie,idx,      0,0,0) :
-                      idx == qsize + 2 ? &ft(ie,          0,0,0) :
-                      /**/               &fm(ie,idx-qsize,0,0,0)),
-                     np2, nlevpk);
-    loop_ik(ttrg, tvr, [&] (int i, int k) { f_ie(i,k) *= s(i); });
-  };
-  Kokkos::fence();
-  Kokkos::parallel_for(m_tp_ne_dss, f);
-  m_dss_be->exchange(m_geometry.m_rspheremp);
+  // The spheremp weighting of fq, fm, fT is applied while packing the DSS
+  // buffers, rather than in a separate pass over the fields.
+  m_dss_be->exchange(m_geometry.m_spheremp, m_geometry.m_rspheremp);
 }
 
 void GllFvRemapImpl
@@ -845,13 +821,13 @@ void GllFvRemapImpl
   const auto gll_metdet = m_geometry.m_metdet;
   const auto fv_metdet = m_data.fv_metdet;
   const auto w_ff = m_data.w_ff;
-  const auto g2f_remapd = m_data.g2f_remapd;
-  const auto dp_fv = m_derived.m_divdp_proj; // store dp_fv between kernels
+  const auto g2f_remapd_g = m_data.g2f_remapd;
+  const auto dp_fv = m_derived.m_divdp_proj; // store dp_fv for the tracers
   const auto hvcoord = m_hvcoord;
   
   ElementOps ops; ops.init(hvcoord);
 
-  // dp
+  const auto dp_g = m_state.m_dp3d;
   const auto tu_ne = m_tu_ne;
   const auto fe = KOKKOS_LAMBDA (const MT& team) {
     KernelVariables kv(team, tu_ne);
@@ -859,11 +835,16 @@ void GllFvRemapImpl
 
     const auto all = Kokkos::ALL();
     const auto rw1 = Kokkos::subview(buf10, kv.team_idx, all, all, all);
+    const auto rw2 = Kokkos::subview(buf11, kv.team_idx, all, all, all);
     const EVU<Real*> rw1s(pack2real(rw1), nreal_per_slot1);
     
     const evucr1 fv_metdet_ie(&fv_metdet(ie,0), nf2),
       gll_metdet_ie(&gll_metdet(ie,0,0), np2);
 
+    const auto g2f_remapd = remapd_to_scratch(kv, g2f_remapd_g);
+    kv.team_barrier();
+
+    // dp
     const evus2 dp_fv_ie(&dp_fv(ie,0,0,0), nf2, nlevpk); {
       const evur2 ps_v_ie(&ps_v(ie,timeidx,0,0), np2, 1), wrk(rw1s.data(), np2, 1),
         ps_v_fv_ie(rw1s.data() + np2, nf2, 1);
@@ -873,34 +854,21 @@ void GllFvRemapImpl
       calc_dp_fv(team, hvcoord, nf2, nlevpk, EVU<Real*>(ps_v_fv_ie.data(), nf2),
                  dp_fv_ie);
     }
-  };
-  Kokkos::fence();
-  Kokkos::parallel_for(m_tp_ne, fe);
-
-  // q
-  const auto dp_g = m_state.m_dp3d;
-  const auto tp_ne_nq = Homme::get_default_team_policy<ExecSpace>(m_data.nelemd * nq);
-  const auto tu_ne_nq = TeamUtils<ExecSpace>(tp_ne_nq);
-  const auto feq = KOKKOS_LAMBDA (const MT& team) {
-    KernelVariables kv(team, nq, tu_ne_nq);
-    const auto ie = kv.ie, iq = kv.iq;
-
-    const auto all = Kokkos::ALL();
-    const auto rw1 = Kokkos::subview(buf10, kv.team_idx, all, all, all);
-    const auto rw2 = Kokkos::subview(buf11, kv.team_idx, all, all, all);
 
-    const evucr1 fv_metdet_ie(&fv_metdet(ie,0), nf2),
-      gll_metdet_ie(&gll_metdet(ie,0,0), np2);
-    const EVU<const Scalar**> dp_fv_ie(&dp_fv(ie,0,0,0), nf2, nlevpk);
-    
-    g2f_mixing_ratio(
-      kv, np2, nf2, nlevpk, g2f_remapd, gll_metdet_ie, w_ff, fv_metdet_ie,
-      evucs_np2_nlev(&dp_g(ie,timeidx,0,0,0)), dp_fv_ie, evucs_np2_nlev(&q_dyn(ie,iq,0,0)),
-      evus_np2_nlev(rw1.data()), evus_np2_nlev(rw2.data()), iq,
-      evus3(&q_fv(ie,0,0,0), q_fv.extent_int(1), q_fv.extent_int(2), q_fv.extent_int(3)));
+    // q
+    const evucs_np2_nlev dp_g_ie(&dp_g(ie,timeidx,0,0,0));
+    const evus3 q_fv_ie(&q_fv(ie,0,0,0), q_fv.extent_int(1), q_fv.extent_int(2),
+                        q_fv.extent_int(3));
+    for (int iq = 0; iq < nq; ++iq) {
+      kv.team_barrier();
+      g2f_mixing_ratio(
+        kv, np2, nf2, nlevpk, g2f_remapd, gll_metdet_ie, w_ff, fv_metdet_ie,
+        dp_g_ie, dp_fv_ie, evucs_np2_nlev(&q_dyn(ie,iq,0,0)),
+        evus_np2_nlev(rw1.data()), evus_np2_nlev(rw2.data()), iq, q_fv_ie);
+    }
   };
   Kokkos::fence();
-  Kokkos::parallel_for(tp_ne_nq, feq);
+  Kokkos::parallel_for(get_tp_ne_remapd(m_tp_ne, nf2, 1), fe);
 #endif  
 }
 
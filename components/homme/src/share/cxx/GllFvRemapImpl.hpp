@@ -89,8 +89,8 @@ struct GllFvRemapImpl {
   Tracers m_tracers;
   Data m_data;
 
-  TeamPolicy m_tp_ne, m_tp_ne_qsize, m_tp_ne_dss;
-  TeamUtils<ExecSpace> m_tu_ne, m_tu_ne_qsize, m_tu_ne_dss;
+  TeamPolicy m_tp_ne;
+  TeamUtils<ExecSpace> m_tu_ne;
 
   std::shared_ptr<BoundaryExchange> m_extrema_be, m_dss_be;
 
@@ -50,6 +50,28 @@ class SphereOperators
 
   template<int NUM_LEVELS>
   using DefaultProvider = ExecViewUnmanaged<const Scalar [NP][NP][NUM_LEVELS]>;
+
+  // In the multi-level operators, each thread handles one gll point, and loops
+  // over the levels. The rows/columns of dvv and the metric terms needed at that
+  // point do not depend on the level, so we load them into registers once, before
+  // the level loop, rather than re-reading them from memory for every level.
+  // Since NP is a compile-time constant, these loops (and the contractions over
+  // kgp in the operators) are fully unrolled, and the arrays live in registers.
+  template<typename MatrixT>
+  KOKKOS_INLINE_FUNCTION static void
+  load_row (const MatrixT& m, const int i, Real (&row)[NP]) {
+    for (int k = 0; k < NP; ++k) {
+      row[k] = m(i,k);
+    }
+  }
+
+  template<typename MatrixT>
+  KOKKOS_INLINE_FUNCTION static void
+  load_col (const MatrixT& m, const int j, Real (&col)[NP]) {
+    for (int k = 0; k < NP; ++k) {
+      col[k] = m(k,j);
+    }
+  }
 public:
 
 
@@ -396,16 +418,23 @@ public:
                          [&](const int loop_idx) {
       const int igp = loop_idx / NP;
       const int jgp = loop_idx % NP;
+      Real dvv_i[NP], dvv_j[NP];
+      load_row(dvv,igp,dvv_i);
+      load_row(dvv,jgp,dvv_j);
+      const Real dinv00 = D_inv(0,0,igp,jgp);
+      const Real dinv01 = D_inv(0,1,igp,jgp);
+      const Real dinv10 = D_inv(1,0,igp,jgp);
+      const Real dinv11 = D_inv(1,1,igp,jgp);
       Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_LEV_REQUEST), [&] (const int& ilev) {
         Scalar v0, v1;
         for (int kgp = 0; kgp < NP; ++kgp) {
-          v0 += dvv(jgp, kgp) * scalar(igp, kgp, ilev);
-          v1 += dvv(igp, kgp) * scalar(kgp, jgp, ilev);
+          v0 += dvv_j[kgp] * scalar(igp, kgp, ilev);
+          v1 += dvv_i[kgp] * scalar(kgp, jgp, ilev);
         }
         v0 *= m_scale_factor_inv;
         v1 *= m_scale_factor_inv;
-        grad_s(0,igp,jgp,ilev) = D_inv(0,0,igp,jgp) * v0 + D_inv(0,1,igp,jgp) * v1;
-        grad_s(1,igp,jgp,ilev) = D_inv(1,0,igp,jgp) * v0 + D_inv(1,1,igp,jgp) * v1;
+        grad_s(0,igp,jgp,ilev) = dinv00 * v0 + dinv01 * v1;
+        grad_s(1,igp,jgp,ilev) = dinv10 * v0 + dinv11 * v1;
       });
     });
     kv.team_barrier();
@@ -442,16 +471,23 @@ public:
                          [&](const int loop_idx) {
       const int igp = loop_idx / NP;
       const int jgp = loop_idx % NP;
+      Real dvv_i[NP], dvv_j[NP];
+      load_row(dvv,igp,dvv_i);
+      load_row(dvv,jgp,dvv_j);
+      const Real dinv00 = D_inv(0,0,igp,jgp);
+      const Real dinv01 = D_inv(0,1,igp,jgp);
+      const Real dinv10 = D_inv(1,0,igp,jgp);
+      const Real dinv11 = D_inv(1,1,igp,jgp);
       Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_LEV_REQUEST), [&] (const int& ilev) {
         Scalar dsdx, dsdy;
         for (int kgp = 0; kgp < NP; ++kgp) {
-          dsdx += dvv(jgp, kgp) * scalar(igp, kgp, ilev);
-          dsdy += dvv(igp, kgp) * scalar(kgp, jgp, ilev);
+          dsdx += dvv_j[kgp] * scalar(igp, kgp, ilev);
+          dsdy += dvv_i[kgp] * scalar(kgp, jgp, ilev);
         }
         dsdx *= m_scale_factor_inv;
         dsdy *= m_scale_factor_inv;
-        grad_s(0,igp,jgp,ilev) += D_inv(0,0,igp,jgp) * dsdx + D_inv(0,1,igp,jgp) * dsdy;
-        grad_s(1,igp,jgp,ilev) += D_inv(1,0,igp,jgp) * dsdx + D_inv(1,1,igp,jgp) * dsdy;
+        grad_s(0,igp,jgp,ilev) += dinv00 * dsdx + dinv01 * dsdy;
+        grad_s(1,igp,jgp,ilev) += dinv10 * dsdx + dinv11 * dsdy;
       });
     });
     kv.team_barrier();
@@ -507,11 +543,16 @@ public:
                          [&](const int loop_idx) {
       const int igp = loop_idx / NP;
       const int jgp = loop_idx % NP;
+      const Real dinv00 = D_inv(0,0,igp,jgp);
+      const Real dinv01 = D_inv(0,1,igp,jgp);
+      const Real dinv10 = D_inv(1,0,igp,jgp);
+      const Real dinv11 = D_inv(1,1,igp,jgp);
+      const Real md = metdet(igp,jgp);
       Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_LEV_REQUEST), [&] (const int& ilev) {
         const auto& v0 = v(0, igp, jgp, ilev);
         const auto& v1 = v(1, igp, jgp, ilev);
-        gv_buf(0,igp,jgp,ilev) = (D_inv(0,0,igp,jgp) * v0 + D_inv(1,0,igp,jgp) * v1) * metdet(igp,jgp);
-        gv_buf(1,igp,jgp,ilev) = (D_inv(0,1,igp,jgp) * v0 + D_inv(1,1,igp,jgp) * v1) * metdet(igp,jgp);
+        gv_buf(0,igp,jgp,ilev) = (dinv00 * v0 + dinv10 * v1) * md;
+        gv_buf(1,igp,jgp,ilev) = (dinv01 * v0 + dinv11 * v1) * md;
       });
     });
     kv.team_barrier();
@@ -522,13 +563,17 @@ public:
                          [&](const int loop_idx) {
       const int igp = loop_idx / NP;
       const int jgp = loop_idx % NP;
+      Real dvv_i[NP], dvv_j[NP];
+      load_row(dvv,igp,dvv_i);
+      load_row(dvv,jgp,dvv_j);
+      const Real rmetdet = 1.0 / metdet(igp, jgp) * m_scale_factor_inv;
       Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_LEV_REQUEST), [&] (const int& ilev) {
         Scalar dudx, dvdy;
         for (int kgp = 0; kgp < NP; ++kgp) {
-          dudx += dvv(jgp, kgp) * gv_buf(0, igp, kgp, ilev);
-          dvdy += dvv(igp, kgp) * gv_buf(1, kgp, jgp, ilev);
+          dudx += dvv_j[kgp] * gv_buf(0, igp, kgp, ilev);
+          dvdy += dvv_i[kgp] * gv_buf(1, kgp, jgp, ilev);
         }
-        combine<CM>((dudx + dvdy) * (1.0 / metdet(igp, jgp) * m_scale_factor_inv),
+        combine<CM>((dudx + dvdy) * rmetdet,
                      div_v(igp, jgp, ilev), alpha, beta);
       });
     });
@@ -574,12 +619,17 @@ public:
                          [&](const int loop_idx) {
       const int igp = loop_idx / NP;
       const int jgp = loop_idx % NP;
+      const Real dinv00 = D_inv(0,0,igp,jgp);
+      const Real dinv01 = D_inv(0,1,igp,jgp);
+      const Real dinv10 = D_inv(1,0,igp,jgp);
+      const Real dinv11 = D_inv(1,1,igp,jgp);
+      const Real md = metdet(igp,jgp);
       Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_LEV_REQUEST), [&] (const int& ilev) {
         const auto& qdpijk = qdp(igp, jgp, ilev);
         const auto v0 = vstar(0, igp, jgp, ilev) * qdpijk;
         const auto v1 = vstar(1, igp, jgp, ilev) * qdpijk;
-        gv(0,igp,jgp,ilev) = (D_inv(0,0,igp,jgp) * v0 + D_inv(1,0,igp,jgp) * v1) * metdet(igp,jgp);
-        gv(1,igp,jgp,ilev) = (D_inv(0,1,igp,jgp) * v0 + D_inv(1,1,igp,jgp) * v1) * metdet(igp,jgp);
+        gv(0,igp,jgp,ilev) = (dinv00 * v0 + dinv10 * v1) * md;
+        gv(1,igp,jgp,ilev) = (dinv01 * v0 + dinv11 * v1) * md;
       });
     });
     kv.team_barrier();
@@ -589,15 +639,19 @@ public:
                          [&](const int loop_idx) {
       const int igp = loop_idx / NP;
       const int jgp = loop_idx % NP;
+      Real dvv_i[NP], dvv_j[NP];
+      load_row(dvv,igp,dvv_i);
+      load_row(dvv,jgp,dvv_j);
+      const Real rmetdet = 1.0 / metdet(igp,jgp) * m_scale_factor_inv;
       Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_LEV_REQUEST), [&] (const int& ilev) {
         Scalar dudx, dvdy;
         for (int kgp = 0; kgp < NP; ++kgp) {
-          dudx += dvv(jgp, kgp) * gv(0, igp, kgp, ilev);
-          dvdy += dvv(igp, kgp) * gv(1, kgp, jgp, ilev);
+          dudx += dvv_j[kgp] * gv(0, igp, kgp, ilev);
+          dvdy += dvv_i[kgp] * gv(1, kgp, jgp, ilev);
         }
         const Scalar qtensijk0 = add_hyperviscosity ? qtens(igp,jgp,ilev) : 0;
         qtens(igp,jgp,ilev) = (qdp(igp,jgp,ilev) +
-                               alpha*((dudx + dvdy) * (1.0 / metdet(igp,jgp) * m_scale_factor_inv)) +
+                               alpha*((dudx + dvdy) * rmetdet) +
                                qtensijk0);
       });
     });
@@ -626,11 +680,15 @@ public:
                          [&](const int loop_idx) {
       const int igp = loop_idx / NP;
       const int jgp = loop_idx % NP;
+      const Real d00 = D(0,0,igp,jgp);
+      const Real d01 = D(0,1,igp,jgp);
+      const Real d10 = D(1,0,igp,jgp);
+      const Real d11 = D(1,1,igp,jgp);
       Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_LEV_REQUEST), [&] (const int& ilev) {
         const auto& u_ijk = u(igp, jgp, ilev);
         const auto& v_ijk = v(igp, jgp, ilev);
-        vcov_buf(0,igp,jgp,ilev) = D(0,0,igp,jgp) * u_ijk + D(0,1,igp,jgp) * v_ijk;
-        vcov_buf(1,igp,jgp,ilev) = D(1,0,igp,jgp) * u_ijk + D(1,1,igp,jgp) * v_ijk;
+        vcov_buf(0,igp,jgp,ilev) = d00 * u_ijk + d01 * v_ijk;
+        vcov_buf(1,igp,jgp,ilev) = d10 * u_ijk + d11 * v_ijk;
       });
     });
     kv.team_barrier();
@@ -640,14 +698,17 @@ public:
                          [&](const int loop_idx) {
       const int igp = loop_idx / NP;
       const int jgp = loop_idx % NP;
+      Real dvv_i[NP], dvv_j[NP];
+      load_row(dvv,igp,dvv_i);
+      load_row(dvv,jgp,dvv_j);
+      const Real rmetdet = 1.0 / metdet(igp, jgp) * m_scale_factor_inv;
       Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_LEV_REQUEST), [&] (const int& ilev) {
         Scalar dudy, dvdx;
         for (int kgp = 0; kgp < NP; ++kgp) {
-          dvdx += dvv(jgp, kgp) * vcov_buf(1, igp, kgp, ilev);
-          dudy += dvv(igp, kgp) * vcov_buf(0, kgp, jgp, ilev);
+          dvdx += dvv_j[kgp] * vcov_buf(1, igp, kgp, ilev);
+          dudy += dvv_i[kgp] * vcov_buf(0, kgp, jgp, ilev);
         }
-        vort(igp, jgp, ilev) = (dvdx - dudy) * (1.0 / metdet(igp, jgp) *
-                                                m_scale_factor_inv);
+        vort(igp, jgp, ilev) = (dvdx - dudy) * rmetdet;
       });
     });
     kv.team_barrier();
@@ -675,11 +736,15 @@ public:
                          [&](const int loop_idx) {
       const int igp = loop_idx / NP;
       const int jgp = loop_idx % NP;
+      const Real d00 = D(0,0,igp,jgp);
+      const Real d01 = D(0,1,igp,jgp);
+      const Real d10 = D(1,0,igp,jgp);
+      const Real d11 = D(1,1,igp,jgp);
       Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_LEV_REQUEST), [&] (const int& ilev) {
         const auto& v0 = v(0,igp,jgp,ilev);
         const auto& v1 = v(1,igp,jgp,ilev);
-        sphere_buf(0,igp,jgp,ilev) = D(0,0,igp,jgp) * v0 + D(0,1,igp,jgp) * v1;
-        sphere_buf(1,igp,jgp,ilev) = D(1,0,igp,jgp) * v0 + D(1,1,igp,jgp) * v1;
+        sphere_buf(0,igp,jgp,ilev) = d00 * v0 + d01 * v1;
+        sphere_buf(1,igp,jgp,ilev) = d10 * v0 + d11 * v1;
       });
     });
     kv.team_barrier();
@@ -689,14 +754,17 @@ public:
                          [&](const int loop_idx) {
       const int igp = loop_idx / NP;
       const int jgp = loop_idx % NP;
+      Real dvv_i[NP], dvv_j[NP];
+      load_row(dvv,igp,dvv_i);
+      load_row(dvv,jgp,dvv_j);
+      const Real rmetdet = 1.0 / metdet(igp, jgp) * m_scale_factor_inv;
       Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_LEV_REQUEST), [&] (const int& ilev) {
         Scalar dudy, dvdx;
         for (int kgp = 0; kgp < NP; ++kgp) {
-          dvdx += dvv(jgp, kgp) * sphere_buf(1, igp, kgp, ilev);
-          dudy += dvv(igp, kgp) * sphere_buf(0, kgp, jgp, ilev);
+          dvdx += dvv_j[kgp] * sphere_buf(1, igp, kgp, ilev);
+          dudy += dvv_i[kgp] * sphere_buf(0, kgp, jgp, ilev);
         }
-        vort(igp, jgp, ilev) = (dvdx - dudy) * (1.0 / metdet(igp, jgp) *
-                                                m_scale_factor_inv);
+        vort(igp, jgp, ilev) = (dvdx - dudy) * rmetdet;
       });
     });
     kv.team_barrier();
@@ -738,11 +806,15 @@ public:
                          [&](const int loop_idx) {
       const int igp = loop_idx / NP;
       const int jgp = loop_idx % NP;
+      const Real dinv00 = D_inv(0,0,igp,jgp);
+      const Real dinv01 = D_inv(0,1,igp,jgp);
+      const Real dinv10 = D_inv(1,0,igp,jgp);
+      const Real dinv11 = D_inv(1,1,igp,jgp);
       Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_LEV_REQUEST), [&] (const int& ilev) {
         const auto v0 = v(0,igp,jgp,ilev);
         const auto v1 = v(1,igp,jgp,ilev);
-        v(0,igp,jgp,ilev) = D_inv(0, 0, igp, jgp) * v0 + D_inv(1, 0, igp, jgp) * v1;
-        v(1,igp,jgp,ilev) = D_inv(0, 1, igp, jgp) * v0 + D_inv(1, 1, igp, jgp) * v1;
+        v(0,igp,jgp,ilev) = dinv00 * v0 + dinv10 * v1;
+        v(1,igp,jgp,ilev) = dinv01 * v0 + dinv11 * v1;
       });
     });
     kv.team_barrier();
@@ -754,13 +826,18 @@ public:
       //       the way the views are accessed.
       const int mgp = loop_idx % NP;
       const int ngp = loop_idx / NP;
+      Real dvv_m[NP], dvv_n[NP], sph_n[NP], sph_m[NP];
+      load_col(dvv,mgp,dvv_m);
+      load_col(dvv,ngp,dvv_n);
+      load_row(spheremp,ngp,sph_n);
+      load_col(spheremp,mgp,sph_m);
       Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_LEV_REQUEST), [&] (const int& ilev) {
         Scalar dd;
         // TODO: move multiplication by scale_factor_inv outside the loop
         for (int jgp = 0; jgp < NP; ++jgp) {
           // Here, v is the temporary buffer, aliased on the input v.
-          dd -= (spheremp(ngp, jgp) * v(0, ngp, jgp, ilev) * dvv(jgp, mgp) +
-                 spheremp(jgp, mgp) * v(1, jgp, mgp, ilev) * dvv(jgp, ngp)) *
+          dd -= (sph_n[jgp] * v(0, ngp, jgp, ilev) * dvv_m[jgp] +
+                 sph_m[jgp] * v(1, jgp, mgp, ilev) * dvv_n[jgp]) *
                 m_scale_factor_inv;
         }
         div_v(ngp, mgp, ilev) = dd;
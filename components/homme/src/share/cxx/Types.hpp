@@ -69,6 +69,17 @@ using HostMemSpace    = Kokkos::HostSpace;
   using MPIMemSpace = HostMemSpace;
 #endif
 
+// The memory space used to stage the MPI buffers on host, if MPI is not done
+// on the pack/unpack buffers. On GPU, page-locked memory makes the copies
+// to/from device faster, and allows them to be asynchronous.
+#if defined(KOKKOS_ENABLE_CUDA)
+  using MPIStagingMemSpace = Kokkos::CudaHostPinnedSpace;
+#elif defined(KOKKOS_ENABLE_HIP)
+  using MPIStagingMemSpace = Kokkos::Experimental::HIPHostPinnedSpace;
+#else
+  using MPIStagingMemSpace = HostMemSpace;
+#endif
+
 // A team member type
 using TeamMember     = Kokkos::TeamPolicy<ExecSpace>::member_type;
 
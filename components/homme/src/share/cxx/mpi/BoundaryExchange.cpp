@@ -28,6 +28,15 @@ namespace Homme
 
 // ======================== IMPLEMENTATION ======================== //
 
+Real BoundaryExchange::s_wait_time = 0;
+
+Real BoundaryExchange::take_wait_time ()
+{
+  const Real wait_time = s_wait_time;
+  s_wait_time = 0;
+  return wait_time;
+}
+
 // Separating these allocations into a small routine works around a Cuda 10/GCC
 // 7/C++14 internal error.
 template <typename A, typename B>
@@ -269,14 +278,20 @@ void BoundaryExchange::registration_completed()
 }
 
 void BoundaryExchange::exchange () {
-  exchange(nullptr);
+  exchange(nullptr, nullptr);
 }
 
 void BoundaryExchange::exchange (ExecViewUnmanaged<const Real * [NP][NP]> rspheremp) {
-  exchange(&rspheremp);
+  exchange(nullptr, &rspheremp);
 }
 
-void BoundaryExchange::exchange (const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp)
+void BoundaryExchange::exchange (ExecViewUnmanaged<const Real * [NP][NP]> spheremp,
+                                 ExecViewUnmanaged<const Real * [NP][NP]> rspheremp) {
+  exchange(&spheremp, &rspheremp);
+}
+
+void BoundaryExchange::exchange (const ExecViewUnmanaged<const Real * [NP][NP]>* spheremp,
+                                 const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp)
 {
   // Check that the registration has completed first
   assert (m_registration_completed);
@@ -307,10 +322,10 @@ void BoundaryExchange::exchange (const ExecViewUnmanaged<const Real * [NP][NP]>*
   m_recv_pending = true;
 
   // ---- Pack and send ---- //
-  pack_and_send ();
+  pack_and_send (spheremp);
 
   // --- Recv and unpack --- //
-  recv_and_unpack (rspheremp);
+  recv_and_unpack (spheremp, rspheremp);
 
 #ifndef HOMME_BE_NO_HASHER
   if (m_diagnostics_level > 0)
@@ -365,9 +380,13 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
       const ExecViewUnmanaged<const int*> ucon_ptr,
       const ExecViewUnmanaged<ExecViewManaged<Real[NP][NP]>**> fields_2d,
       const ExecViewUnmanaged<ExecViewUnmanaged<Real*>**> send_2d_buffers,
+      const ExecViewUnmanaged<const Real * [NP][NP]>* spheremp,
       const int num_elems, const int num_2d_fields) {
   HOMMEXX_STATIC const ConnectionHelpers helpers;
   const int nconn = ucon.extent_int(0);
+  const bool scale = spheremp != nullptr;
+  ExecViewUnmanaged<const Real * [NP][NP]> smp;
+  if (scale) smp = *spheremp;
   Kokkos::parallel_for(
     Kokkos::RangePolicy<ExecSpace>(0, num_2d_fields*nconn),
     KOKKOS_LAMBDA(const int it) {
@@ -380,8 +399,10 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
       const auto& pts = helpers.CONNECTION_PTS[info.direction][info.local_dir];
       const auto& sb = send_2d_buffers(ifield, buffer_iconn);
       const auto& f2 = fields_2d(info.local_lid, ifield);
-      for (int k = 0; k < helpers.CONNECTION_SIZE[info.kind]; ++k)
+      for (int k = 0; k < helpers.CONNECTION_SIZE[info.kind]; ++k) {
         sb(k) = f2(pts[k].ip, pts[k].jp);
+        if (scale) sb(k) *= smp(info.local_lid, pts[k].ip, pts[k].jp);
+      }
     });
 }
 
@@ -391,12 +412,16 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
       const ExecViewUnmanaged<const int*> ucon_ptr,
       const ExecViewUnmanaged<ExecViewManaged<Scalar[NP][NP][NUM_LEV_PACKS]>**> fields_3d,
       const ExecViewUnmanaged<ExecViewUnmanaged<Scalar**>**> send_3d_buffers,
+      const ExecViewUnmanaged<const Real * [NP][NP]>* spheremp,
       const int num_elems, const int num_3d_fields,
       ExecViewManaged<int*>* nlev_packs_ = nullptr) {
   assert(partial_column == (nlev_packs_ != nullptr));
   if (partial_column) assert(nlev_packs_->extent_int(0) == num_3d_fields);
   ExecViewUnmanaged<const int*> nlev_packs;
   if (partial_column) nlev_packs = *nlev_packs_;
+  const bool scale = spheremp != nullptr;
+  ExecViewUnmanaged<const Real * [NP][NP]> smp;
+  if (scale) smp = *spheremp;
   if (OnGpu<ExecSpace>::value) {
     const ConnectionHelpers helpers;
     const int nconn = ucon.extent_int(0);
@@ -417,8 +442,10 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
         const auto& pts = helpers.CONNECTION_PTS[info.direction][info.local_dir];
         const auto& sb = send_3d_buffers(ifield, buffer_iconn);
         const auto& f3 = fields_3d(info.local_lid, ifield);
-        for (int k = 0; k < helpers.CONNECTION_SIZE[info.kind]; ++k)
+        for (int k = 0; k < helpers.CONNECTION_SIZE[info.kind]; ++k) {
           sb(k, ilev) = f3(pts[k].ip, pts[k].jp, ilev);
+          if (scale) sb(k, ilev) *= smp(info.local_lid, pts[k].ip, pts[k].jp);
+        }
       });
   } else {
     const auto num_parallel_iterations = num_elems*num_3d_fields;
@@ -455,13 +482,21 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
               auto* const sbp = &sb(k, 0);
               const auto* const f3p = &f3(pts[k].ip, pts[k].jp, 0);
               Kokkos::parallel_for(tvr, [&] (const int& ilev) { sbp[ilev] = f3p[ilev]; });
+              if (scale) {
+                const auto& s = smp(ie, pts[k].ip, pts[k].jp);
+                Kokkos::parallel_for(tvr, [&] (const int& ilev) { sbp[ilev] *= s; });
+              }
             });
         }
       });
   }
 }
 
-void BoundaryExchange::pack_and_send ()
+void BoundaryExchange::pack_and_send () {
+  pack_and_send(nullptr);
+}
+
+void BoundaryExchange::pack_and_send (const ExecViewUnmanaged<const Real * [NP][NP]>* spheremp)
 {
   tstart("be pack_and_send");
   // The registration MUST be completed by now
@@ -494,31 +529,26 @@ void BoundaryExchange::pack_and_send ()
   const auto& ucon_ptr = m_connectivity->get_d_ucon_ptr();
   // First, pack 2d fields (if any)...
   if (m_num_2d_fields > 0)
-    pack(ucon, ucon_ptr, m_2d_fields, m_send_2d_buffers, m_num_elems,
+    pack(ucon, ucon_ptr, m_2d_fields, m_send_2d_buffers, spheremp, m_num_elems,
          m_num_2d_fields);
   // ...then pack 3d fields (if any)...
   if (m_num_3d_fields > 0) {
     if (m_3d_nlev_pack_d.size() > 0)
-      pack<NUM_LEV, true>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
+      pack<NUM_LEV, true>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers, spheremp,
                           m_num_elems, m_num_3d_fields, &m_3d_nlev_pack_d);
     else
-      pack<NUM_LEV>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
+      pack<NUM_LEV>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers, spheremp,
                     m_num_elems, m_num_3d_fields);
   }
   // ...then pack 3d interface fields (if any)
   if (m_num_3d_int_fields > 0)
-    pack<NUM_LEV_P>(ucon, ucon_ptr, m_3d_int_fields, m_send_3d_int_buffers,
+    pack<NUM_LEV_P>(ucon, ucon_ptr, m_3d_int_fields, m_send_3d_int_buffers, spheremp,
                     m_num_elems, m_num_3d_int_fields);
   Kokkos::fence();
 
   // ---- Send ---- //
-  tstart("be sync_send_buffer");
-  m_buffers_manager->sync_send_buffer(this); // Deep copy send_buffer into mpi_send_buffer (no op if MPI is on device)
-  tstop("be sync_send_buffer");
   tstart("be send");
-  if ( ! m_send_requests.empty())
-    HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_send_requests.size(), m_send_requests.data()),
-                            m_connectivity->get_comm().mpi_comm());
+  start_sends();
 
   // Notify a send is ongoing
   m_send_pending = true;
@@ -526,7 +556,7 @@ void BoundaryExchange::pack_and_send ()
 }
 
 void BoundaryExchange::recv_and_unpack () {
-  recv_and_unpack(nullptr);
+  recv_and_unpack(nullptr, nullptr);
 }
 
 // assume:conn-edges-snwe
@@ -535,9 +565,13 @@ unpack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> u
         const ExecViewUnmanaged<const int*> ucon_ptr,
         const ExecViewUnmanaged<ExecViewManaged<Real[NP][NP]>**> fields_2d,
         const ExecViewUnmanaged<ExecViewUnmanaged<Real*>**> recv_2d_buffers,
+        const ExecViewUnmanaged<const Real * [NP][NP]>* spheremp,
         const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp,
         const int num_elems, const int num_2d_fields) {
   HOMMEXX_STATIC const ConnectionHelpers helpers;
+  const bool scale = spheremp != nullptr;
+  ExecViewUnmanaged<const Real * [NP][NP]> smp;
+  if (scale) smp = *spheremp;
   Kokkos::parallel_for(
     Kokkos::RangePolicy<ExecSpace>(0, num_elems*num_2d_fields),
     KOKKOS_LAMBDA(const int it) {
@@ -545,6 +579,11 @@ unpack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> u
       const int ifield = it % num_2d_fields;
       const auto iconn_beg = ucon_ptr(ie), iconn_end = ucon_ptr(ie+1);
       const auto& f2 = fields_2d(ie, ifield);
+      if (scale) {
+        for (int i = 0; i < NP; ++i)
+          for (int j = 0; j < NP; ++j)
+            f2(i, j) *= smp(ie, i, j);
+      }
       for (int k = 0; k < NP; ++k) {
         for (const int iedge : helpers.UNPACK_EDGES_ORDER) {
           f2(helpers.CONNECTION_PTS_FWD[iedge][k].ip,
@@ -581,6 +620,7 @@ unpack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> u
         const ExecViewUnmanaged<const int*> ucon_ptr,
         const ExecViewUnmanaged<ExecViewManaged<Scalar[NP][NP][NUM_LEV_PACKS]>**> fields_3d,
         const ExecViewUnmanaged<ExecViewUnmanaged<Scalar**>**> recv_3d_buffers,
+        const ExecViewUnmanaged<const Real * [NP][NP]>* spheremp,
         const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp,
         const int num_elems, const int num_3d_fields,
         ExecViewManaged<int*>* nlev_packs_ = nullptr) {
@@ -588,6 +628,9 @@ unpack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> u
   if (partial_column) assert(nlev_packs_->extent_int(0) == num_3d_fields);
   ExecViewUnmanaged<const int*> nlev_packs;
   if (partial_column) nlev_packs = *nlev_packs_;
+  const bool scale = spheremp != nullptr;
+  ExecViewUnmanaged<const Real * [NP][NP]> smp;
+  if (scale) smp = *spheremp;
   if (OnGpu<ExecSpace>::value) {
     const ConnectionHelpers helpers;
     Kokkos::parallel_for(
@@ -602,6 +645,11 @@ unpack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> u
         const int ie = it / (num_3d_fields*NUM_LEV_PACKS);
         const auto iconn_beg = ucon_ptr(ie);
         const auto& f3 = fields_3d(ie, ifield);
+        if (scale) {
+          for (int i = 0; i < NP; ++i)
+            for (int j = 0; j < NP; ++j)
+              f3(i, j, ilev) *= smp(ie, i, j);
+        }
         for (int k = 0; k < NP; ++k) {
           for (const int iedge : helpers.UNPACK_EDGES_ORDER) {
             const auto& pts = helpers.CONNECTION_PTS_FWD[iedge][k];
@@ -643,6 +691,14 @@ unpack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> u
           kv.team, partial_column ? nlev_packs(ifield) : NUM_LEV_PACKS);
         const auto& f3 = fields_3d(ie, ifield);
         const auto iconn_beg = ucon_ptr(ie), iconn_end = ucon_ptr(ie+1);
+        if (scale) {
+          for (int i = 0; i < NP; ++i)
+            for (int j = 0; j < NP; ++j) {
+              auto* const f3p = &f3(i, j, 0);
+              const auto& s = smp(ie, i, j);
+              Kokkos::parallel_for(tvr, [&] (const int& ilev) { f3p[ilev] *= s; });
+            }
+        }
         const auto ef = [&] (const int& iedge, const int& k, const int& ip, const int& jp) {
           const auto& r3 = recv_3d_buffers(ifield, iconn_beg + iedge);
           auto* const f3p = &f3(ip, jp, 0);
@@ -676,7 +732,8 @@ unpack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> u
   }
 }
 
-void BoundaryExchange::recv_and_unpack (const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp)
+void BoundaryExchange::recv_and_unpack (const ExecViewUnmanaged<const Real * [NP][NP]>* spheremp,
+                                         const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp)
 {
   tstart("be recv_and_unpack");
   tstart("be recv_and_unpack book");
@@ -710,36 +767,29 @@ void BoundaryExchange::recv_and_unpack (const ExecViewUnmanaged<const Real * [NP
 
   // ---- Recv ---- //
   tstart("be recv waitall");
-  if ( ! m_recv_requests.empty())
-    HOMMEXX_MPI_CHECK_ERROR(MPI_Waitall(m_recv_requests.size(), m_recv_requests.data(), MPI_STATUSES_IGNORE),
-                            m_connectivity->get_comm().mpi_comm()); // Wait for all data to arrive
+  wait_recvs();
   m_recv_pending = false;
   tstop("be recv waitall");
 
-  tstart("be recv_and_unpack book");
-  m_buffers_manager->sync_recv_buffer(this);
-
-  tstop("be recv_and_unpack book");
-
   // --- Unpack --- //
   const auto& ucon = m_connectivity->get_d_ucon();
   const auto& ucon_ptr = m_connectivity->get_d_ucon_ptr();
   // First, unpack 2d fields (if any)...
   if (m_num_2d_fields>0)
-    unpack(ucon, ucon_ptr, m_2d_fields, m_recv_2d_buffers, rspheremp, m_num_elems,
+    unpack(ucon, ucon_ptr, m_2d_fields, m_recv_2d_buffers, spheremp, rspheremp, m_num_elems,
            m_num_2d_fields);
   // ...then unpack 3d fields (if any)...
   if (m_num_3d_fields>0) {
     if (m_3d_nlev_pack_d.size() > 0)
-      unpack<NUM_LEV, true>(ucon, ucon_ptr, m_3d_fields, m_recv_3d_buffers, rspheremp,
+      unpack<NUM_LEV, true>(ucon, ucon_ptr, m_3d_fields, m_recv_3d_buffers, spheremp, rspheremp,
                             m_num_elems, m_num_3d_fields, &m_3d_nlev_pack_d);
     else
-      unpack<NUM_LEV>(ucon, ucon_ptr, m_3d_fields, m_recv_3d_buffers, rspheremp,
+      unpack<NUM_LEV>(ucon, ucon_ptr, m_3d_fields, m_recv_3d_buffers, spheremp, rspheremp,
                       m_num_elems, m_num_3d_fields);
   }
   // ...then unpack 3d interface fields (if any).
   if (m_num_3d_int_fields > 0)
-    unpack<NUM_LEV_P>(ucon, ucon_ptr, m_3d_int_fields, m_recv_3d_int_buffers, rspheremp,
+    unpack<NUM_LEV_P>(ucon, ucon_ptr, m_3d_int_fields, m_recv_3d_int_buffers, spheremp, rspheremp,
                       m_num_elems, m_num_3d_int_fields);
   Kokkos::fence();
 
@@ -749,10 +799,13 @@ void BoundaryExchange::recv_and_unpack (const ExecViewUnmanaged<const Real * [NP
   // reusable.
 
   tstart("be waitall 2");
-  if ( ! m_send_requests.empty())
+  if ( ! m_send_requests.empty()) {
+    const double wait_start = MPI_Wtime();
     HOMMEXX_MPI_CHECK_ERROR(MPI_Waitall(m_send_requests.size(), m_send_requests.data(),
                                         MPI_STATUSES_IGNORE),
                             m_connectivity->get_comm().mpi_comm()); // Wait for all data to arrive
+    s_wait_time += MPI_Wtime() - wait_start;
+  }
   tstop("be waitall 2");
 
   tstart("be recv_and_unpack book");
@@ -862,10 +915,7 @@ void BoundaryExchange::pack_and_send_min_max ()
   Kokkos::fence();
 
   // ---- Send ---- //
-  m_buffers_manager->sync_send_buffer(this);
-  if ( ! m_send_requests.empty())
-    HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_send_requests.size(), m_send_requests.data()),
-                            m_connectivity->get_comm().mpi_comm());
+  start_sends();
 
   // Mark send buffer as busy
   m_send_pending = true;
@@ -965,11 +1015,7 @@ void BoundaryExchange::recv_and_unpack_min_max ()
   }
 
   // ---- Recv ---- //
-  if ( ! m_recv_requests.empty())
-    HOMMEXX_MPI_CHECK_ERROR(MPI_Waitall(m_recv_requests.size(), m_recv_requests.data(), MPI_STATUSES_IGNORE),
-                            m_connectivity->get_comm().mpi_comm()); // Wait for all data to arrive
-
-  m_buffers_manager->sync_recv_buffer(this); // Deep copy mpi_recv_buffer into recv_buffer (no op if MPI is on device)
+  wait_recvs();
 
   unpack_min_max(m_connectivity->get_d_ucon(), m_connectivity->get_d_ucon_ptr(),
                  m_1d_fields, m_recv_1d_buffers, m_num_elems, m_num_1d_fields);
@@ -979,9 +1025,12 @@ void BoundaryExchange::recv_and_unpack_min_max ()
   // this object has finished its send requests, and may erroneously reuse the
   // buffers. Therefore, we must ensure that, upon return, all buffers are
   // reusable.
-  if ( ! m_send_requests.empty())
+  if ( ! m_send_requests.empty()) {
+    const double wait_start = MPI_Wtime();
     HOMMEXX_MPI_CHECK_ERROR(MPI_Waitall(m_send_requests.size(), m_send_requests.data(), MPI_STATUSES_IGNORE),
                             m_connectivity->get_comm().mpi_comm()); // Wait for all data to arrive
+    s_wait_time += MPI_Wtime() - wait_start;
+  }
 
   // Release the send/recv buffers
   m_buffers_manager->unlock_buffers();
@@ -1148,10 +1197,12 @@ void BoundaryExchange::build_buffer_views_and_requests()
     free_requests();
     m_send_requests.resize(npids);
     m_recv_requests.resize(npids);
+    m_pid_buf_offsets.resize(npids+1);
     MPIViewManaged<Real*>::pointer_type send_ptr = buffers_manager->get_mpi_send_buffer().data();
     MPIViewManaged<Real*>::pointer_type recv_ptr = buffers_manager->get_mpi_recv_buffer().data();
     int offset = 0;
     for (size_t ip = 0; ip < npids; ++ip) {
+      m_pid_buf_offsets[ip] = offset;
       int count = 0;
       for (int k = pid_offsets[ip]; k < pid_offsets[ip+1]; ++k) {
         const auto i = slot_idx_to_elem_conn_pair[k];
@@ -1168,12 +1219,66 @@ void BoundaryExchange::build_buffer_views_and_requests()
                               m_connectivity->get_comm().mpi_comm());
       offset += count;
     }
+    m_pid_buf_offsets[npids] = offset;
+
+    if (buffers_manager->are_mpi_buffers_staged()) {
+      buffers_manager->reserve_send_spaces(npids);
+    }
   }
 
   // Now the buffer views and the requests are built
   m_buffer_views_and_requests_built = true;
 }
 
+void BoundaryExchange
+::start_sends () {
+  if (m_send_requests.empty()) return;
+
+  const auto mpi_comm = m_connectivity->get_comm().mpi_comm();
+  if ( ! m_buffers_manager->are_mpi_buffers_staged()) {
+    HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_send_requests.size(), m_send_requests.data()),
+                            mpi_comm);
+    return;
+  }
+
+  // Start all the slice copies, each on its own instance, then send each slice
+  // as soon as its own copy is on host, while the other copies are in flight
+  for (size_t ip = 0; ip < m_send_requests.size(); ++ip) {
+    m_buffers_manager->sync_send_buffer(ip, m_pid_buf_offsets[ip],
+                                        m_pid_buf_offsets[ip+1]-m_pid_buf_offsets[ip]);
+  }
+  for (size_t ip = 0; ip < m_send_requests.size(); ++ip) {
+    m_buffers_manager->fence_send_buffer(ip);
+    HOMMEXX_MPI_CHECK_ERROR(MPI_Start(&m_send_requests[ip]), mpi_comm);
+  }
+}
+
+void BoundaryExchange
+::wait_recvs () {
+  if (m_recv_requests.empty()) return;
+
+  const auto mpi_comm = m_connectivity->get_comm().mpi_comm();
+  if ( ! m_buffers_manager->are_mpi_buffers_staged()) {
+    const double wait_start = MPI_Wtime();
+    HOMMEXX_MPI_CHECK_ERROR(MPI_Waitall(m_recv_requests.size(), m_recv_requests.data(), MPI_STATUSES_IGNORE),
+                            mpi_comm); // Wait for all data to arrive
+    s_wait_time += MPI_Wtime() - wait_start;
+    return;
+  }
+
+  // Copy each slice to device as soon as it arrives, while waiting for the others
+  for (size_t i = 0; i < m_recv_requests.size(); ++i) {
+    int ip;
+    const double wait_start = MPI_Wtime();
+    HOMMEXX_MPI_CHECK_ERROR(MPI_Waitany(m_recv_requests.size(), m_recv_requests.data(), &ip, MPI_STATUS_IGNORE),
+                            mpi_comm);
+    s_wait_time += MPI_Wtime() - wait_start;
+    m_buffers_manager->sync_recv_buffer(m_pid_buf_offsets[ip],
+                                        m_pid_buf_offsets[ip+1]-m_pid_buf_offsets[ip]);
+  }
+  m_buffers_manager->fence_recv_buffer();
+}
+
 void BoundaryExchange
 ::free_requests () {
   for (size_t i=0; i<m_send_requests.size(); ++i)
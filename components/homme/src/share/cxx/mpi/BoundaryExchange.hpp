@@ -191,6 +191,11 @@ public:
   // Exchange all registered 2d and 3d fields
   void exchange ();
   void exchange (ExecViewUnmanaged<const Real * [NP][NP]> rspheremp);
+  // Same as above, but the fields are not yet multiplied by spheremp. The
+  // multiplication is done while packing and unpacking, rather than in a
+  // separate pass over the fields.
+  void exchange (ExecViewUnmanaged<const Real * [NP][NP]> spheremp,
+                 ExecViewUnmanaged<const Real * [NP][NP]> rspheremp);
 
   // Exchange all registered 1d fields, performing min/max operations with neighbors
   void exchange_min_max ();
@@ -234,8 +239,15 @@ public:
   // 0, corresponding to none.
   void set_diagnostics_level (const int level);
 
+  // Wall time spent by all BoundaryExchange objects waiting for MPI messages,
+  // since the last call. Used to exclude communication from the per-element
+  // cost measured for zoltan2 rebalancing.
+  static Real take_wait_time ();
+
 private:
 
+  static Real s_wait_time;
+
   short int m_exchange_type;
 
   // Make MpiBuffersManager a friend, so it can call the method underneath
@@ -250,6 +262,8 @@ private:
 
   std::vector<MPI_Request>  m_send_requests;
   std::vector<MPI_Request>  m_recv_requests;
+  // Offset of each pid's slice in the mpi buffers (one more entry than requests)
+  std::vector<int>          m_pid_buf_offsets;
 
   ExecViewManaged<ExecViewManaged<Scalar[2][NUM_LEV]>**>            m_1d_fields;
   ExecViewManaged<ExecViewManaged<Real[NP][NP]>**>                  m_2d_fields;
@@ -311,10 +325,17 @@ private:
     std::vector<int>& h_slot_idx_to_elem_conn_pair,
     std::vector<int>& pids, std::vector<int>& pids_os);
   void free_requests();
+  // Start the sends/wait for the recvs. If the mpi buffers are staged, each pid's
+  // slice is copied to host right before its send, and to device as soon as it arrives.
+  void start_sends();
+  void wait_recvs();
   // Only the impl knows about the raw pointer.
-  void exchange(const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
+  void exchange(const ExecViewUnmanaged<const Real * [NP][NP]>* spheremp,
+                const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
+  void pack_and_send(const ExecViewUnmanaged<const Real * [NP][NP]>* spheremp);
 public: // This is semantically private but must be public for nvcc.
-  void recv_and_unpack(const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
+  void recv_and_unpack(const ExecViewUnmanaged<const Real * [NP][NP]>* spheremp,
+                       const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
 };
 
 // ============================ REGISTER METHODS ========================= //
@@ -9,6 +9,8 @@
 #include "BoundaryExchange.hpp"
 #include "Connectivity.hpp"
 
+#include <type_traits>
+
 namespace Homme
 {
 
@@ -18,6 +20,7 @@ MpiBuffersManager::MpiBuffersManager ()
  , m_local_buffer_size (0)
  , m_buffers_busy      (false)
  , m_views_are_valid   (false)
+ , m_stage_mpi_buffers (!std::is_same<MPIMemSpace,ExecMemSpace>::value)
 {
   // The "fake" buffers used for MISSING connections. These do not depend on the requirements
   // from the custormers, so we can create them right away.
@@ -81,8 +84,15 @@ void MpiBuffersManager::allocate_buffers ()
   m_local_buffer = ExecViewManaged<Real*>("local buffer", m_local_buffer_size);
 
   // The buffers used in MPI calls
-  m_mpi_send_buffer = Kokkos::create_mirror_view(decltype(m_mpi_send_buffer)::execution_space(),m_send_buffer);
-  m_mpi_recv_buffer = Kokkos::create_mirror_view(decltype(m_mpi_recv_buffer)::execution_space(),m_recv_buffer);
+  if (m_stage_mpi_buffers) {
+    m_mpi_send_staging = decltype(m_mpi_send_staging)("mpi send buffer", m_mpi_buffer_size);
+    m_mpi_recv_staging = decltype(m_mpi_recv_staging)("mpi recv buffer", m_mpi_buffer_size);
+    m_mpi_send_buffer = decltype(m_mpi_send_buffer)(m_mpi_send_staging.data(), m_mpi_buffer_size);
+    m_mpi_recv_buffer = decltype(m_mpi_recv_buffer)(m_mpi_recv_staging.data(), m_mpi_buffer_size);
+  } else {
+    m_mpi_send_buffer = Kokkos::create_mirror_view(decltype(m_mpi_send_buffer)::execution_space(),m_send_buffer);
+    m_mpi_recv_buffer = Kokkos::create_mirror_view(decltype(m_mpi_recv_buffer)::execution_space(),m_recv_buffer);
+  }
 
   m_views_are_valid = true;
 
@@ -93,6 +103,30 @@ void MpiBuffersManager::allocate_buffers ()
   }
 }
 
+void MpiBuffersManager::set_stage_mpi_buffers (const bool stage)
+{
+  // The mpi buffers must be staged if MPI is not done on the exec space
+  assert (stage || std::is_same<MPIMemSpace,ExecMemSpace>::value);
+
+  // Changing this after allocation would require to reallocate the buffers
+  assert (!m_views_are_valid);
+
+  m_stage_mpi_buffers = stage;
+}
+
+void MpiBuffersManager::reserve_send_spaces (const int num_slices)
+{
+  assert (m_stage_mpi_buffers);
+
+  if (static_cast<int>(m_send_spaces.size())>=num_slices) {
+    return;
+  }
+
+  // The send buffer is filled on the default instance, which is fenced before
+  // the copies start, so the new instances need no ordering with it.
+  m_send_spaces = Kokkos::Experimental::partition_space(ExecSpace(),std::vector<int>(num_slices,1));
+}
+
 void MpiBuffersManager::lock_buffers ()
 {
   // Make sure we are not trying to lock buffers already locked
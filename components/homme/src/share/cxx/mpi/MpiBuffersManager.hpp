@@ -66,9 +66,14 @@ class BoundaryExchange;
  *    the mpi_send/mpi_recv buffers are used by MPI.
  *
  * The BM class also takes care of syncing the send/recv buffers
- * with the mpi_send/mpi_recv buffers, via a call to Kokkos::deep_copy,
- * which is a no-op if the MPIMemSpace=ExecMemSpace, that is, if
- * the MPI is performed using pointers on the Execution Space.
+ * with the mpi_send/mpi_recv buffers. This is needed only if the
+ * mpi buffers are 'staged', that is, if they are separate host
+ * buffers. In that case, they are allocated in page-locked memory
+ * (see MPIStagingMemSpace), and synced one slice at a time, so that
+ * BE can overlap the copy of a slice with the MPI transfer of another.
+ * The buffers are staged if MPIMemSpace!=ExecMemSpace; in CPU builds,
+ * staging can be forced (e.g., to test it), but it cannot be disabled
+ * if MPIMemSpace!=ExecMemSpace.
  *
  */
 
@@ -99,6 +104,11 @@ public:
   // Allocate the buffers (overwriting possibly already allocated ones if needed)
   void allocate_buffers ();
 
+  // Whether the mpi send/recv buffers are host copies of the send/recv buffers.
+  // Note: set_stage_mpi_buffers must be called before the buffers are allocated
+  void set_stage_mpi_buffers (const bool stage);
+  bool are_mpi_buffers_staged () const { return m_stage_mpi_buffers; }
+
   // Lock/unlock the buffers are busy
   void lock_buffers ();
   void unlock_buffers ();
@@ -126,10 +136,18 @@ private:
   //       it can register/unregister itself as a customer
   void add_customer (BoundaryExchange* add_me);
   void remove_customer (BoundaryExchange* remove_me);
-  // Deep copy the send/recv buffer to/from the mpi_send/recv buffer
-  // Note: these are no-ops if MPIMemSpace=ExecMemSpace
-  void sync_send_buffer (BoundaryExchange* customer);
-  void sync_recv_buffer (BoundaryExchange* customer);
+  // Make sure there are at least num_slices exec space instances for the send copies
+  void reserve_send_spaces (const int num_slices);
+  // Copy the slice [offset,offset+count) of the send (recv) buffer to (from)
+  // the mpi_send (mpi_recv) buffer. Both copies are asynchronous. The send copy of
+  // slice islice runs on its own instance, and it is complete after a call to
+  // fence_send_buffer(islice), so that each slice can be sent as soon as its own
+  // copy is done. The recv copy is complete only after a call to fence_recv_buffer.
+  // Note: these should be called only if the mpi buffers are staged
+  void sync_send_buffer (const int islice, const int offset, const int count);
+  void fence_send_buffer (const int islice);
+  void sync_recv_buffer (const int offset, const int count);
+  void fence_recv_buffer ();
 
   // Small struct, to hold customer's needs. We could use an std::pair, but this is more verbose
   struct CustomerNeeds {
@@ -163,6 +181,9 @@ private:
   // Used to check whether user can still request different sizes
   bool m_views_are_valid;
 
+  // Whether the mpi buffers are separate (host) buffers
+  bool m_stage_mpi_buffers;
+
   // Customers of this MpiBuffersManager, each with its local and mpi sizes
   std::map<BoundaryExchange*,CustomerNeeds>  m_customers;
 
@@ -174,45 +195,52 @@ private:
   ExecViewManaged<Real*>  m_recv_buffer;
   ExecViewManaged<Real*>  m_local_buffer;
 
-  // The mpi buffers (same as the previous send/recv buffers if MPIMemSpace=ExecMemSpace)
+  // The mpi buffers (same as the previous send/recv buffers, unless staged)
   MPIViewManaged<Real*>   m_mpi_send_buffer;
   MPIViewManaged<Real*>   m_mpi_recv_buffer;
 
+  // The page-locked storage of the mpi buffers (only if staged)
+  ViewManaged<Real*,MPIStagingMemSpace>  m_mpi_send_staging;
+  ViewManaged<Real*,MPIStagingMemSpace>  m_mpi_recv_staging;
+
   // The blackhole send/recv buffers (used for missing connections)
   ExecViewManaged<Real*>  m_blackhole_send_buffer;
   ExecViewManaged<Real*>  m_blackhole_recv_buffer;
+
+  // One exec space instance per send slice (only if staged)
+  std::vector<ExecSpace>  m_send_spaces;
 };
 
-inline void MpiBuffersManager::sync_send_buffer (BoundaryExchange* customer)
+inline void MpiBuffersManager::sync_send_buffer (const int islice, const int offset, const int count)
 {
-  // Only customers can call this
-  assert (m_customers.find(customer)!=m_customers.end());
-
-  const size_t customer_mpi_buffer_size = m_customers.find(customer)->second.mpi_buffer_size;
-  if (customer_mpi_buffer_size<m_mpi_buffer_size) {
-    // Avoid copying more than we need
-    MPIViewUnmanaged<Real*>  mpi_send_view(m_mpi_send_buffer.data(),customer_mpi_buffer_size);
-    ExecViewUnmanaged<const Real*> send_view(m_send_buffer.data(),customer_mpi_buffer_size);
-    Kokkos::deep_copy(mpi_send_view, send_view);
-  } else {
-    Kokkos::deep_copy(m_mpi_send_buffer, m_send_buffer);
-  }
+  assert (m_stage_mpi_buffers);
+  assert (islice>=0 && islice<static_cast<int>(m_send_spaces.size()));
+  assert (offset>=0 && offset+count<=static_cast<int>(m_mpi_buffer_size));
+
+  MPIViewUnmanaged<Real*>  mpi_send_view(m_mpi_send_buffer.data()+offset,count);
+  ExecViewUnmanaged<const Real*> send_view(m_send_buffer.data()+offset,count);
+  Kokkos::deep_copy(m_send_spaces[islice], mpi_send_view, send_view);
 }
 
-inline void MpiBuffersManager::sync_recv_buffer (BoundaryExchange* customer)
+inline void MpiBuffersManager::fence_send_buffer (const int islice)
 {
-  // Only customers can call this
-  assert (m_customers.find(customer)!=m_customers.end());
-
-  const size_t customer_mpi_buffer_size = m_customers.find(customer)->second.mpi_buffer_size;
-  if (customer_mpi_buffer_size<m_mpi_buffer_size) {
-    // Avoid copying more than we need
-    MPIViewUnmanaged<const Real*>  mpi_recv_view(m_mpi_recv_buffer.data(),customer_mpi_buffer_size);
-    ExecViewUnmanaged<Real*> recv_view(m_recv_buffer.data(),customer_mpi_buffer_size);
-    Kokkos::deep_copy(recv_view, mpi_recv_view);
-  } else {
-    Kokkos::deep_copy(m_recv_buffer, m_mpi_recv_buffer);
-  }
+  assert (islice>=0 && islice<static_cast<int>(m_send_spaces.size()));
+  m_send_spaces[islice].fence();
+}
+
+inline void MpiBuffersManager::sync_recv_buffer (const int offset, const int count)
+{
+  assert (m_stage_mpi_buffers);
+  assert (offset>=0 && offset+count<=static_cast<int>(m_mpi_buffer_size));
+
+  MPIViewUnmanaged<const Real*>  mpi_recv_view(m_mpi_recv_buffer.data()+offset,count);
+  ExecViewUnmanaged<Real*> recv_view(m_recv_buffer.data()+offset,count);
+  Kokkos::deep_copy(ExecSpace(), recv_view, mpi_recv_view);
+}
+
+inline void MpiBuffersManager::fence_recv_buffer ()
+{
+  ExecSpace().fence();
 }
 
 inline ExecViewUnmanaged<Real*>
@@ -15,6 +15,7 @@
 #include "ErrorDefs.hpp"
 #include "CamForcing.hpp"
 #include "profiling.hpp"
+#include "mpi/BoundaryExchange.hpp"
 
 namespace Homme
 {
@@ -180,6 +181,11 @@ void prim_run_subcycle_c (const Real& dt, int& nstep, int& nm1, int& n0, int& np
   GPTLstop("tl-sc prim_run_subcycle_c");
 }
 
+Real get_bndry_exchange_wait_time_c ()
+{
+  return BoundaryExchange::take_wait_time();
+}
+
 } // extern "C"
 
 void update_q (const int np1_qdp, const int np1)
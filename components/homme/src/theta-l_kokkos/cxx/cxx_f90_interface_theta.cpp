@@ -404,25 +404,31 @@ void init_functors_c (const bool& allocate_buffer)
   if (allocate_buffer) {
     // Make the functor request their buffer to the buffers manager
     // Note: diagnostics also needs buffers
-    fbm.request_size(caar.requested_buffer_size());
+    // Note: the functors are never live at the same time (each one uses its buffers
+    //       only within its own phase of the time step), so they all share the same memory.
+    fbm.request_size(caar.requested_buffer_size(), "caar");
     if (params.transport_alg == 0)
-      fbm.request_size(c.get<EulerStepFunctor>().requested_buffer_size());
+      fbm.request_size(c.get<EulerStepFunctor>().requested_buffer_size(), "euler_step");
 #ifdef HOMME_ENABLE_COMPOSE
     else
-      fbm.request_size(c.get<ComposeTransport>().requested_buffer_size());
+      fbm.request_size(c.get<ComposeTransport>().requested_buffer_size(), "compose");
 #endif
-    fbm.request_size(hvf.requested_buffer_size());
-    fbm.request_size(diag.requested_buffer_size());
-    fbm.request_size(ff.requested_buffer_size());
-    fbm.request_size(vrm.requested_buffer_size());
-    fbm.request_size(limiter.requested_buffer_size());
+    fbm.request_size(hvf.requested_buffer_size(), "hypervis");
+    fbm.request_size(diag.requested_buffer_size(), "diagnostics");
+    fbm.request_size(ff.requested_buffer_size(), "forcing");
+    fbm.request_size(vrm.requested_buffer_size(), "vertical_remap");
+    fbm.request_size(limiter.requested_buffer_size(), "limiter");
     if (need_dirk) {
       const auto& dirk = Context::singleton().get<DirkFunctor>();
-      fbm.request_size(dirk.requested_buffer_size());
+      fbm.request_size(dirk.requested_buffer_size(), "dirk");
     }
 
     // Allocate the buffers in the FunctorsBuffersManager, then tell the functors to grab their buffers
     fbm.allocate();
+
+    if (c.get<Comm>().root()) {
+      fbm.print_requests();
+    }
   }
 
   caar.init_buffers(fbm);
@@ -250,6 +250,157 @@ void zoltan_partition_problem(
 }
 
 
+void zoltan_repartition_problem(
+    int *nelem,
+    int *xadj,
+    int *adjncy,
+    double *adjwgt,
+    double *vwgt,
+    int *nparts,
+    MPI_Comm comm,
+    double *xcoord,
+    double *ycoord,
+    double *zcoord, int *coord_dimension,
+    int *result_parts,
+    int *partmethod){
+  //repartitions an existing (fortran based) partition in result_parts using
+  //the measured per-element cost in vwgt as vertex weights.
+  //Unlike zoltan_partition_problem, the input map follows the current
+  //ownership of the elements, so that zoltan2 can minimize the migration.
+  using namespace Teuchos;
+  typedef int zlno_t;
+  typedef int zgno_t;
+  typedef double zscalar_t;
+
+  typedef Tpetra::Map<>::node_type znode_t;
+  typedef Tpetra::Map<zlno_t, zgno_t, znode_t> map_t;
+  size_t numGlobalCoords = *nelem;
+
+  Teuchos::RCP<const Teuchos::Comm<int> > tcomm =
+      Teuchos::RCP<const Teuchos::Comm<int> > (new Teuchos::MpiComm<int> (comm));
+  const int myRank = tcomm->getRank();
+
+  if (myRank == 0){
+    std::cout << "Zoltan2 repartitioning, metrics before:" << std::endl;
+  }
+  zoltan2_print_metrics(nelem, xadj, adjncy, adjwgt, vwgt, nparts, comm, result_parts);
+
+  //elements currently owned by this rank.
+  std::vector<zgno_t> my_gids;
+  for (int i = 0; i < *nelem; ++i){
+    if (result_parts[i] - 1 == myRank){
+      my_gids.push_back(i);
+    }
+  }
+  const ArrayView<const zgno_t> my_gids_view(my_gids.data(), my_gids.size());
+  RCP<const map_t> map = rcp (new map_t (numGlobalCoords, my_gids_view, 0, tcomm));
+
+  typedef Tpetra::CrsGraph<zlno_t, zgno_t, znode_t> tcrsGraph_t;
+  RCP<tcrsGraph_t> TpetraCrsGraph(new tcrsGraph_t (map, 0));
+
+  const zlno_t numMyElements = map->getNodeNumElements ();
+
+  std::vector<zscalar_t> local_vwgt(numMyElements);
+  std::vector<zscalar_t> local_adjwgt;
+  for (zlno_t lclRow = 0; lclRow < numMyElements; ++lclRow) {
+    const zgno_t gblRow = map->getGlobalElement (lclRow);
+    zgno_t begin = xadj[gblRow];
+    zgno_t end = xadj[gblRow + 1];
+    const ArrayView< const zgno_t > indices(adjncy+begin, end-begin);
+    TpetraCrsGraph->insertGlobalIndices(gblRow, indices);
+    local_vwgt[lclRow] = vwgt[gblRow];
+    local_adjwgt.insert(local_adjwgt.end(), adjwgt + begin, adjwgt + end);
+  }
+  TpetraCrsGraph->fillComplete ();
+
+  RCP<const tcrsGraph_t> const_data = rcp_const_cast<const tcrsGraph_t>(TpetraCrsGraph);
+  typedef Tpetra::MultiVector<zscalar_t, zlno_t, zgno_t, znode_t> tMVector_t;
+  typedef Zoltan2::XpetraCrsGraphAdapter<tcrsGraph_t, tMVector_t> adapter_t;
+  RCP<adapter_t> ia (new adapter_t(const_data, 1, 1));
+
+  /***********************************SET COORDINATES*********************/
+  const int coord_dim = *coord_dimension;
+  std::vector<std::vector<zscalar_t> > local_coords(coord_dim, std::vector<zscalar_t>(numMyElements));
+  for (zlno_t lclRow = 0; lclRow < numMyElements; ++lclRow) {
+    const zgno_t gblRow = map->getGlobalElement (lclRow);
+    local_coords[0][lclRow] = xcoord[gblRow];
+    local_coords[1][lclRow] = ycoord[gblRow];
+    if (coord_dim == 3){
+      local_coords[2][lclRow] = zcoord[gblRow];
+    }
+  }
+  Teuchos::Array<Teuchos::ArrayView<const zscalar_t> > coordView(coord_dim);
+  for (int d = 0; d < coord_dim; ++d){
+    coordView[d] = Teuchos::ArrayView<const zscalar_t>(local_coords[d].data(), numMyElements);
+  }
+
+  RCP<tMVector_t> coords(new tMVector_t(map, coordView.view(0, coord_dim), coord_dim));
+  RCP<const tMVector_t> const_coords = rcp_const_cast<const tMVector_t>(coords);
+  Zoltan2::XpetraMultiVectorAdapter<tMVector_t> *adapter = (new Zoltan2::XpetraMultiVectorAdapter<tMVector_t>(const_coords));
+
+  ia->setCoordinateInput(adapter);
+  ia->setEdgeWeights(local_adjwgt.data(), 1, 0);
+  ia->setVertexWeights(local_vwgt.data(), 1, 0);
+  /***********************************SET COORDINATES*********************/
+
+  typedef Zoltan2::PartitioningProblem<adapter_t> xcrsGraph_problem_t;
+  ParameterList zoltan2_parameters;
+  zoltan2_parameters.set("compute_metrics", true);
+  zoltan2_parameters.set("imbalance_tolerance", "1.05");
+  zoltan2_parameters.set("num_global_parts", tcomm->getSize());
+  zoltan2_parameters.set("partitioning_approach", "repartition");
+  switch (*partmethod){
+  case 13:
+  case 14:
+    zoltan2_parameters.set("algorithm", "parmetis");
+    break;
+  case 12:
+  case 21:
+    zoltan2_parameters.set("algorithm", "zoltan");
+    {
+      Teuchos::ParameterList &zparams =
+        zoltan2_parameters.sublist("zoltan_parameters",false);
+      zparams.set("LB_METHOD", "PHG");
+      zparams.set("LB_APPROACH", "REPARTITION");
+    }
+    break;
+  case 7:
+  case 8:
+    zoltan2_parameters.set("algorithm", "multijagged");
+    break;
+  default :
+    zoltan2_parameters.set("algorithm", "rcb");
+  }
+
+  RCP<xcrsGraph_problem_t> homme_repartition_problem (new xcrsGraph_problem_t(ia.getRawPtr(),&zoltan2_parameters,tcomm));
+
+  homme_repartition_problem->solve();
+  tcomm->barrier();
+
+  std::vector<int> tmp_result_parts(numGlobalCoords, 0);
+  const int *parts = (const int *)homme_repartition_problem->getSolution().getPartListView();
+
+  //the result is always fortran based, no task mapping is done on top of it.
+  const int fortran_shift = 1;
+  for (zlno_t lclRow = 0; lclRow < numMyElements; ++lclRow) {
+    const zgno_t gblRow = map->getGlobalElement (lclRow);
+    tmp_result_parts[gblRow] = parts[lclRow] + fortran_shift;
+  }
+
+  Teuchos::reduceAll<int, int>(
+      *(tcomm),
+      Teuchos::REDUCE_SUM,
+      numGlobalCoords,
+      &(tmp_result_parts[0]),
+      result_parts);
+
+  if (myRank == 0){
+    std::cout << "Zoltan2 repartitioning, metrics after:" << std::endl;
+  }
+  zoltan2_print_metrics(nelem, xadj, adjncy, adjwgt, vwgt, nparts, comm, result_parts);
+}
+
+
 void zoltan_map_problem(
     int *nelem,
     int *xadj,
@@ -709,12 +860,25 @@ void zoltan2_print_metrics(
       &(weighted_hops),
       &(total_weighted_hops));
 
+  //part weights are computed redundantly on each rank from the global arrays.
+  double total_vertex_weight = 0;
+  double max_part_weight = 0;
+  for (int i = 0; i < np; ++i){
+    total_vertex_weight += part_vertex_weights[i];
+    max_part_weight = std::max(max_part_weight, part_vertex_weights[i]);
+  }
+  const double avg_part_weight = total_vertex_weight / np;
+  const double weight_imbalance = avg_part_weight > 0 ? max_part_weight / avg_part_weight : 1.0;
+
   if (myRank == 0){
     std::cout << "\tGLOBAL NUM MESSAGES:" << global_num_messages << std::endl
               << "\tMAX MESSAGES:       " << global_max_messages << std::endl
               << "\tGLOBAL EDGE CUT:    " << global_edge_cut << std::endl
               << "\tMAX EDGE CUT:       " << global_max_edge_cut << std::endl
-              << "\tTOTAL WEIGHTED HOPS:" << total_weighted_hops << std::endl;
+              << "\tTOTAL WEIGHTED HOPS:" << total_weighted_hops << std::endl
+              << "\tMAX PART WEIGHT:    " << max_part_weight << std::endl
+              << "\tAVG PART WEIGHT:    " << avg_part_weight << std::endl
+              << "\tWEIGHT IMBALANCE:   " << weight_imbalance << std::endl;
 
   }
   delete [] machine_extent_wrap_around;
@@ -863,6 +1027,25 @@ void zoltan_map_problem(
 #else
   std::cerr << "Homme is not compiled with Trilinos!!" << std::endl;
 #endif}
+void zoltan_repartition_problem(
+    int *nelem,
+    int *xadj,
+    int *adjncy,
+    double *adjwgt,
+    double *vwgt,
+    int *nparts,
+    MPI_Comm comm,
+    double *xcoord,
+    double *ycoord,
+    double *zcoord, int *coord_dimension,
+    int *result_parts,
+    int *partmethod){
+#if HAVE_TRILINOS
+  std::cerr << "Trilinos is not compiled with Zoltan2!!" << std::endl;
+#else
+  std::cerr << "Homme is not compiled with Trilinos!!" << std::endl;
+#endif
+}
 void zoltan2_print_metrics(
     int *nelem,
     int *xadj,
@@ -81,6 +81,26 @@ extern "C" {
 }
 #endif
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+ void zoltan_repartition_problem(
+     int *nelem,
+     int *xadj,
+     int *adjncy,
+     double *adjwgt,
+     double *vwgt,
+     int *nparts,
+     MPI_Comm comm,
+     double *xcoord,
+     double *ycoord,
+     double *zcoord, int *coord_dimension,
+     int *result_parts,
+     int *partmethod);
+#ifdef __cplusplus
+}
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
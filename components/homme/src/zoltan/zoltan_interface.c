@@ -195,6 +195,40 @@ void zoltanpart_(int *nelem, int *xadj,int *adjncy,double *adjwgt,double *vwgt,
 
 }
 
+void zoltanrepart_(int *nelem, int *xadj,int *adjncy,double *adjwgt,double *vwgt, int *nparts, MPI_Fint *comm,
+    double *xcoord, double *ycoord, double *zcoord, int *coord_dimension, int *result_parts, int *partmethod) {
+  MPI_Comm c_comm = MPI_Comm_f2c(*comm);
+
+#if HAVE_TRILINOS
+#if TRILINOS_HAVE_ZOLTAN2
+  sort_graph(nelem,xadj,adjncy,adjwgt,vwgt);
+
+  zoltan_repartition_problem(
+      nelem, xadj,adjncy,adjwgt,vwgt,
+      nparts,
+      c_comm,
+      xcoord, ycoord, zcoord, coord_dimension,
+      result_parts, partmethod);
+#else
+  int mype2, size2;
+  MPI_Comm_rank(c_comm, &mype2);
+  MPI_Comm_size(c_comm, &size2);
+  if (mype2 == 0) {
+    printf("Zoltan cannot be used, Trilinos is not compiled with Zoltan2.");
+  }
+  exit(1);
+#endif
+#else
+  int mype2, size2;
+  MPI_Comm_rank(c_comm, &mype2);
+  MPI_Comm_size(c_comm, &size2);
+  if (mype2 == 0) {
+    printf("Zoltan cannot be used, HOMME is not compiled with Trilinos.");
+  }
+  exit(1);
+#endif
+}
+
 void z2printmetrics_(
     int *nelem,
     int *xadj,int *adjncy,double *adjwgt,double *vwgt,
@@ -265,3 +299,12 @@ void ZOLTANPART(int *nelem, int *xadj,int *adjncy,double *adjwgt,double *vwgt, i
   zoltanpart_(nelem, xadj,adjncy,adjwgt,vwgt, nparts, comm, xcoord, ycoord, zcoord, coord_dimension, result_parts,partmethod, mappingmethod);
 }
 
+void zoltanrepart(int *nelem, int *xadj,int *adjncy,double *adjwgt,double *vwgt, int *nparts, MPI_Fint *comm,
+    double *xcoord, double *ycoord, double *zcoord, int *coord_dimension, int *result_parts, int *partmethod) {
+  zoltanrepart_(nelem, xadj,adjncy,adjwgt,vwgt, nparts, comm, xcoord, ycoord, zcoord, coord_dimension, result_parts, partmethod);
+}
+
+void ZOLTANREPART(int *nelem, int *xadj,int *adjncy,double *adjwgt,double *vwgt, int *nparts, MPI_Fint *comm,
+    double *xcoord, double *ycoord, double *zcoord, int *coord_dimension, int *result_parts, int *partmethod) {
+  zoltanrepart_(nelem, xadj,adjncy,adjwgt,vwgt, nparts, comm, xcoord, ycoord, zcoord, coord_dimension, result_parts, partmethod);
+}
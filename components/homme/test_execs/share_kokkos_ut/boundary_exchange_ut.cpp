@@ -301,6 +301,198 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
     }}}}}}
   }
 
+  // Check that weighting the fields by spheremp inside the exchange gives
+  // the same answer (bfb) as weighting them before the exchange.
+  {
+    std::uniform_real_distribution<Real> dsmp(0.5, 2.0);
+    ExecViewManaged<Real*[NP][NP]> spheremp("spheremp", num_elements);
+    ExecViewManaged<Real*[NP][NP]> rspheremp("rspheremp", num_elements);
+    auto spheremp_host = Kokkos::create_mirror_view(spheremp);
+    auto rspheremp_host = Kokkos::create_mirror_view(rspheremp);
+    genRandArray(spheremp_host,engine,dsmp);
+    for (int ie=0; ie<num_elements; ++ie) {
+      for (int igp=0; igp<NP; ++igp) {
+        for (int jgp=0; jgp<NP; ++jgp) {
+          rspheremp_host(ie,igp,jgp) = 1.0/spheremp_host(ie,igp,jgp);
+    }}}
+    Kokkos::deep_copy(spheremp, spheremp_host);
+    Kokkos::deep_copy(rspheremp, rspheremp_host);
+
+    genRandArray(field_2d_cxx_host,engine,dreal);
+    genRandArray(field_3d_cxx_host,engine,dreal);
+    genRandArray(field_3d_int_cxx_host,engine,dreal);
+    genRandArray(field_4d_cxx_host,engine,dreal);
+
+    // Reference: weight the fields, then exchange
+    auto field_2d_ref     = Kokkos::create_mirror_view(field_2d_cxx);
+    auto field_3d_ref     = Kokkos::create_mirror_view(field_3d_cxx);
+    auto field_3d_int_ref = Kokkos::create_mirror_view(field_3d_int_cxx);
+    auto field_4d_ref     = Kokkos::create_mirror_view(field_4d_cxx);
+    Kokkos::deep_copy(field_2d_ref,     field_2d_cxx_host);
+    Kokkos::deep_copy(field_3d_ref,     field_3d_cxx_host);
+    Kokkos::deep_copy(field_3d_int_ref, field_3d_int_cxx_host);
+    Kokkos::deep_copy(field_4d_ref,     field_4d_cxx_host);
+    for (int ie=0; ie<num_elements; ++ie) {
+      for (int igp=0; igp<NP; ++igp) {
+        for (int jgp=0; jgp<NP; ++jgp) {
+          const Real smp = spheremp_host(ie,igp,jgp);
+          field_2d_ref(ie,field_2d_idim,igp,jgp) *= smp;
+          for (int ilev=0; ilev<NUM_LEV; ++ilev) {
+            field_3d_ref(ie,field_3d_idim,igp,jgp,ilev) *= smp;
+            for (int idim=0; idim<DIM; ++idim) {
+              field_4d_ref(ie,field_4d_outer_idim,idim,igp,jgp,ilev) *= smp;
+            }
+          }
+          for (int ilev=0; ilev<NUM_LEV_P; ++ilev) {
+            field_3d_int_ref(ie,field_3d_idim,igp,jgp,ilev) *= smp;
+          }
+    }}}
+    Kokkos::deep_copy(field_2d_cxx,     field_2d_ref);
+    Kokkos::deep_copy(field_3d_cxx,     field_3d_ref);
+    Kokkos::deep_copy(field_3d_int_cxx, field_3d_int_ref);
+    Kokkos::deep_copy(field_4d_cxx,     field_4d_ref);
+    be1->exchange(rspheremp);
+    be2->exchange(rspheremp);
+    Kokkos::deep_copy(field_2d_ref,     field_2d_cxx);
+    Kokkos::deep_copy(field_3d_ref,     field_3d_cxx);
+    Kokkos::deep_copy(field_3d_int_ref, field_3d_int_cxx);
+    Kokkos::deep_copy(field_4d_ref,     field_4d_cxx);
+
+    // Weighting done by the exchange
+    Kokkos::deep_copy(field_2d_cxx,     field_2d_cxx_host);
+    Kokkos::deep_copy(field_3d_cxx,     field_3d_cxx_host);
+    Kokkos::deep_copy(field_3d_int_cxx, field_3d_int_cxx_host);
+    Kokkos::deep_copy(field_4d_cxx,     field_4d_cxx_host);
+    be1->exchange(spheremp, rspheremp);
+    be2->exchange(spheremp, rspheremp);
+    Kokkos::deep_copy(field_2d_cxx_host,     field_2d_cxx);
+    Kokkos::deep_copy(field_3d_cxx_host,     field_3d_cxx);
+    Kokkos::deep_copy(field_3d_int_cxx_host, field_3d_int_cxx);
+    Kokkos::deep_copy(field_4d_cxx_host,     field_4d_cxx);
+
+    for (int ie=0; ie<num_elements; ++ie) {
+      for (int igp=0; igp<NP; ++igp) {
+        for (int jgp=0; jgp<NP; ++jgp) {
+          REQUIRE(field_2d_cxx_host(ie,field_2d_idim,igp,jgp) == field_2d_ref(ie,field_2d_idim,igp,jgp));
+          for (int ilev=0; ilev<NUM_LEV; ++ilev) {
+            for (int iv=0; iv<VECTOR_SIZE; ++iv) {
+              REQUIRE(field_3d_cxx_host(ie,field_3d_idim,igp,jgp,ilev)[iv] ==
+                      field_3d_ref(ie,field_3d_idim,igp,jgp,ilev)[iv]);
+              for (int idim=0; idim<DIM; ++idim) {
+                REQUIRE(field_4d_cxx_host(ie,field_4d_outer_idim,idim,igp,jgp,ilev)[iv] ==
+                        field_4d_ref(ie,field_4d_outer_idim,idim,igp,jgp,ilev)[iv]);
+              }
+            }
+          }
+          for (int ilev=0; ilev<NUM_LEV_P; ++ilev) {
+            for (int iv=0; iv<VECTOR_SIZE; ++iv) {
+              REQUIRE(field_3d_int_cxx_host(ie,field_3d_idim,igp,jgp,ilev)[iv] ==
+                      field_3d_int_ref(ie,field_3d_idim,igp,jgp,ilev)[iv]);
+            }
+          }
+    }}}
+  }
+
+  // Check that staging the mpi buffers through host memory (done on GPU if
+  // MPI is not on device) gives the same answer (bfb) as not staging them.
+  // Here, the staging is forced, so that it is tested also on CPU.
+  {
+    auto staged_buffers_manager = std::make_shared<MpiBuffersManager>(connectivity);
+    auto staged_buffers_manager_min_max = std::make_shared<MpiBuffersManager>(connectivity);
+    staged_buffers_manager->set_stage_mpi_buffers(true);
+    staged_buffers_manager_min_max->set_stage_mpi_buffers(true);
+
+    auto be1s = std::make_shared<BoundaryExchange>(connectivity,staged_buffers_manager);
+    auto be2s = std::make_shared<BoundaryExchange>(connectivity,staged_buffers_manager);
+    auto be3s = std::make_shared<BoundaryExchange>(connectivity,staged_buffers_manager_min_max);
+
+    be1s->set_num_fields(0,num_scalar_fields_2d,DIM*num_vector_fields_3d);
+    be1s->register_field(field_2d_cxx,1,field_2d_idim);
+    be1s->register_field(field_4d_cxx,  field_4d_outer_idim,DIM,0);
+    be1s->registration_completed();
+
+    be2s->set_num_fields(0,0,num_scalar_fields_3d,num_scalar_interface_fields_3d);
+    be2s->register_field(field_3d_cxx,1,field_3d_idim);
+    be2s->register_field(field_3d_int_cxx,1,field_3d_idim);
+    be2s->registration_completed();
+
+    be3s->set_num_fields(num_min_max_fields_1d,0,0);
+    be3s->register_min_max_fields(field_1d_cxx,num_min_max_fields_1d,0);
+    be3s->registration_completed();
+
+    genRandArray(field_1d_cxx_host,engine,dreal_minmax);
+    genRandArray(field_2d_cxx_host,engine,dreal);
+    genRandArray(field_3d_cxx_host,engine,dreal);
+    genRandArray(field_3d_int_cxx_host,engine,dreal);
+    genRandArray(field_4d_cxx_host,engine,dreal);
+
+    // Reference: exchange without staging
+    auto field_1d_ref     = Kokkos::create_mirror_view(field_1d_cxx);
+    auto field_2d_ref     = Kokkos::create_mirror_view(field_2d_cxx);
+    auto field_3d_ref     = Kokkos::create_mirror_view(field_3d_cxx);
+    auto field_3d_int_ref = Kokkos::create_mirror_view(field_3d_int_cxx);
+    auto field_4d_ref     = Kokkos::create_mirror_view(field_4d_cxx);
+    Kokkos::deep_copy(field_1d_cxx,     field_1d_cxx_host);
+    Kokkos::deep_copy(field_2d_cxx,     field_2d_cxx_host);
+    Kokkos::deep_copy(field_3d_cxx,     field_3d_cxx_host);
+    Kokkos::deep_copy(field_3d_int_cxx, field_3d_int_cxx_host);
+    Kokkos::deep_copy(field_4d_cxx,     field_4d_cxx_host);
+    be1->exchange();
+    be2->exchange();
+    be3->exchange_min_max();
+    Kokkos::deep_copy(field_1d_ref,     field_1d_cxx);
+    Kokkos::deep_copy(field_2d_ref,     field_2d_cxx);
+    Kokkos::deep_copy(field_3d_ref,     field_3d_cxx);
+    Kokkos::deep_copy(field_3d_int_ref, field_3d_int_cxx);
+    Kokkos::deep_copy(field_4d_ref,     field_4d_cxx);
+
+    // Exchange with staging
+    Kokkos::deep_copy(field_1d_cxx,     field_1d_cxx_host);
+    Kokkos::deep_copy(field_2d_cxx,     field_2d_cxx_host);
+    Kokkos::deep_copy(field_3d_cxx,     field_3d_cxx_host);
+    Kokkos::deep_copy(field_3d_int_cxx, field_3d_int_cxx_host);
+    Kokkos::deep_copy(field_4d_cxx,     field_4d_cxx_host);
+    be1s->exchange();
+    be2s->exchange();
+    be3s->exchange_min_max();
+    Kokkos::deep_copy(field_1d_cxx_host,     field_1d_cxx);
+    Kokkos::deep_copy(field_2d_cxx_host,     field_2d_cxx);
+    Kokkos::deep_copy(field_3d_cxx_host,     field_3d_cxx);
+    Kokkos::deep_copy(field_3d_int_cxx_host, field_3d_int_cxx);
+    Kokkos::deep_copy(field_4d_cxx_host,     field_4d_cxx);
+
+    for (int ie=0; ie<num_elements; ++ie) {
+      for (int ifield=0; ifield<num_min_max_fields_1d; ++ifield) {
+        for (int ilev=0; ilev<NUM_LEV; ++ilev) {
+          for (int iv=0; iv<VECTOR_SIZE; ++iv) {
+            REQUIRE(field_1d_cxx_host(ie,ifield,MIN_ID,ilev)[iv] == field_1d_ref(ie,ifield,MIN_ID,ilev)[iv]);
+            REQUIRE(field_1d_cxx_host(ie,ifield,MAX_ID,ilev)[iv] == field_1d_ref(ie,ifield,MAX_ID,ilev)[iv]);
+      }}}
+      for (int itl=0; itl<NUM_TIME_LEVELS; ++itl) {
+        for (int igp=0; igp<NP; ++igp) {
+          for (int jgp=0; jgp<NP; ++jgp) {
+            REQUIRE(field_2d_cxx_host(ie,itl,igp,jgp) == field_2d_ref(ie,itl,igp,jgp));
+            for (int ilev=0; ilev<NUM_LEV; ++ilev) {
+              for (int iv=0; iv<VECTOR_SIZE; ++iv) {
+                REQUIRE(field_3d_cxx_host(ie,itl,igp,jgp,ilev)[iv] == field_3d_ref(ie,itl,igp,jgp,ilev)[iv]);
+                for (int idim=0; idim<DIM; ++idim) {
+                  REQUIRE(field_4d_cxx_host(ie,itl,idim,igp,jgp,ilev)[iv] == field_4d_ref(ie,itl,idim,igp,jgp,ilev)[iv]);
+                }
+              }
+            }
+            for (int ilev=0; ilev<NUM_LEV_P; ++ilev) {
+              for (int iv=0; iv<VECTOR_SIZE; ++iv) {
+                REQUIRE(field_3d_int_cxx_host(ie,itl,igp,jgp,ilev)[iv] == field_3d_int_ref(ie,itl,igp,jgp,ilev)[iv]);
+              }
+            }
+      }}}
+    }
+
+    be1s->clean_up();
+    be2s->clean_up();
+    be3s->clean_up();
+  }
+
   // Cleanup
   cleanup_f90();  // Deallocate stuff in the F90 module
   be1->clean_up();
@@ -12,7 +12,10 @@
 
 #include <assert.h>
 #include <stdio.h>
+#include <chrono>
+#include <cstdlib>
 #include <random>
+#include <string>
 
 using namespace Homme;
 
@@ -553,6 +556,23 @@ class compute_sphere_operator_test_ml {
     Kokkos::deep_copy(scalar_output_host, scalar_output_d);
   };
 
+  // Average time (in seconds) of one call of the functor for the given tag, over all elements
+  template<typename Tag>
+  double time_functor(const int ntrials) {
+    auto policy = Homme::get_default_team_policy<ExecSpace, Tag>(_num_elems);
+    sphere_ops.allocate_buffers(policy);
+    // Warm up
+    Kokkos::parallel_for(policy, *this);
+    Kokkos::fence();
+    const auto start = std::chrono::steady_clock::now();
+    for (int n = 0; n < ntrials; ++n) {
+      Kokkos::parallel_for(policy, *this);
+    }
+    Kokkos::fence();
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(stop - start).count() / ntrials;
+  }
+
 };  // end of class def compute_sphere_op_test_ml
 
 // SHMEM ????
@@ -1339,3 +1359,67 @@ TEST_CASE("vorticity_sphere_vector",
   std::cout << "test vorticity_sphere_vector multilevel finished. \n";
 
 }  // end of test div_sphere_wk_ml
+
+// Microbenchmark of the multi-level operators. It is hidden (not run by default);
+// run it with `sphere_op_ut "[perf]"`. The number of elements and of trials
+// can be set via the env vars HOMMEXX_SPHERE_OP_NELEMS and HOMMEXX_SPHERE_OP_NTRIALS.
+// The flop counts are per gll point and (padded) level. The bytes per element
+// are the minimum memory traffic: input and output fields, plus the geometry
+// (dvv is shared by all elements, and not counted).
+TEST_CASE("sphere_op_ml_perf", "[.][perf]") {
+  const char* nelems_env  = std::getenv("HOMMEXX_SPHERE_OP_NELEMS");
+  const char* ntrials_env = std::getenv("HOMMEXX_SPHERE_OP_NTRIALS");
+  const int elements = nelems_env!=nullptr ? std::atoi(nelems_env) : 1000;
+  const int ntrials  = ntrials_env!=nullptr ? std::atoi(ntrials_env) : 20;
+
+  compute_sphere_operator_test_ml tester(elements);
+
+  constexpr int np2 = NP*NP;
+  constexpr int nlev = NUM_LEV*VECTOR_SIZE;
+  constexpr int fld = np2*nlev*sizeof(Real);
+  constexpr int geo = np2*sizeof(Real);
+
+  struct OpInfo {
+    std::string name;
+    double time;
+    int flops_per_pt;   // per gll point and level
+    int bytes_per_elem;
+  };
+
+  const OpInfo ops[] = {
+    // grad: 2 contractions, scaling, 2x2 matvec. In: 1 field; out: 2 fields; geo: D_inv
+    {"gradient_sphere",
+     tester.time_functor<compute_sphere_operator_test_ml::TagGradientSphereML>(ntrials),
+     4*NP+8, 3*fld+4*geo},
+    // div: 2x2 matvec and metdet, 2 contractions, sum and scaling. In: 2 fields; out: 1 field; geo: D_inv, metdet
+    {"divergence_sphere",
+     tester.time_functor<compute_sphere_operator_test_ml::TagDivergenceSphereML>(ntrials),
+     4*NP+10, 3*fld+5*geo},
+    // vort: 2x2 matvec, 2 contractions, difference and scaling. In: 2 fields; out: 1 field; geo: D, metdet
+    {"vorticity_sphere",
+     tester.time_functor<compute_sphere_operator_test_ml::TagVorticityVectorML>(ntrials),
+     4*NP+8, 3*fld+5*geo},
+    // Note: div_wk overwrites its input, so it runs after the other ops using vector_input_d.
+    // div_wk: 2x2 matvec, NP terms of 2 triple products each. In: 2 fields; out: 1 field; geo: D_inv, spheremp
+    {"divergence_sphere_wk",
+     tester.time_functor<compute_sphere_operator_test_ml::TagDivergenceSphereWkML>(ntrials),
+     7*NP+6, 3*fld+5*geo},
+    // laplace_simple: gradient_sphere followed by divergence_sphere_wk, through a team buffer
+    {"laplace_simple",
+     tester.time_functor<compute_sphere_operator_test_ml::TagSimpleLaplaceML>(ntrials),
+     (4*NP+8)+(7*NP+6), 2*fld+5*geo},
+  };
+
+  std::cout << "sphere operators perf: " << elements << " elements, " << ntrials << " trials, "
+            << "NP=" << NP << ", levels=" << nlev << "\n";
+  for (const auto& op : ops) {
+    const double flops = static_cast<double>(op.flops_per_pt)*np2*nlev*elements;
+    const double bytes = static_cast<double>(op.bytes_per_elem)*elements;
+    std::cout << "  " << op.name << ": "
+              << op.time*1e6 << " us, "
+              << flops/op.time*1e-9 << " GFLOP/s, "
+              << op.bytes_per_elem << " bytes/element, "
+              << bytes/op.time*1e-9 << " GB/s\n";
+    REQUIRE(op.time>0);
+  }
+}
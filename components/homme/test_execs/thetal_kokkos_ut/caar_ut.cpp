@@ -1,5 +1,7 @@
 #include <catch2/catch.hpp>
 
+#include <chrono>
+#include <cstdlib>
 #include <random>
 
 #include "Types.hpp"
@@ -439,6 +441,53 @@ TEST_CASE("caar", "caar_testing") {
     }
   }
 
+  // Timing of caar, to compare builds with different HOMMEXX_VECTOR_SIZE.
+  // It only runs if the env var HOMMEXX_PERF_NTRIALS is set to a positive number.
+  SECTION ("caar_perf") {
+    const char* ntrials_env = std::getenv("HOMMEXX_PERF_NTRIALS");
+    const int ntrials = ntrials_env!=nullptr ? std::atoi(ntrials_env) : 0;
+    if (ntrials>0) {
+      for (const bool hydrostatic : {true,false}) {
+        params.theta_hydrostatic_mode = hydrostatic;
+        params.theta_adv_form = AdvectionForm::NonConservative;
+        params.rsplit = 3;
+
+        RKStageData data (2, 0, 1, 0, 1.0, 1.0, 1.0, 1.0, 1.0);
+
+        CaarFunctorImpl caar(elems,tracers,ref_FE,hvcoord,sphop,params);
+        FunctorsBuffersManager fbm;
+        fbm.request_size( caar.requested_buffer_size() );
+        fbm.request_size(limiter.requested_buffer_size());
+        fbm.allocate();
+        caar.init_buffers(fbm);
+        limiter.init_buffers(fbm);
+        caar.init_boundary_exchanges(c.get_ptr<MpiBuffersManager>());
+
+        // Re-randomize the state before each run (outside of the timed region),
+        // so that repeated steps do not drift into non-physical states.
+        double time = 0;
+        for (int n=0; n<=ntrials; ++n) {
+          elems.m_state.randomize(seed,max_pressure,hvcoord.ps0,hvcoord.hybrid_ai0,geo.m_phis);
+          elems.m_derived.randomize(seed,dp3d_min(elems.m_state.m_dp3d));
+          Kokkos::fence();
+          const auto start = std::chrono::steady_clock::now();
+          caar.run(data);
+          Kokkos::fence();
+          const auto stop = std::chrono::steady_clock::now();
+          // The first run is a warm up
+          if (n>0) {
+            time += std::chrono::duration<double>(stop - start).count();
+          }
+        }
+        if (comm.root()) {
+          std::cout << "caar perf (" << (hydrostatic ? "hydrostatic" : "non-hydrostatic")
+                    << ", VECTOR_SIZE=" << VECTOR_SIZE << ", " << num_elems << " elements): "
+                    << time/ntrials*1e6 << " us per run\n";
+        }
+      }
+    }
+  }
+
   SECTION ("limiter_dp3d") {
 
     // rsplit and hydro_mode are irrelevant for this test, so just pick something
@@ -1,5 +1,7 @@
 #include <catch2/catch.hpp>
 
+#include <chrono>
+#include <cstdlib>
 #include <random>
 
 #include "Types.hpp"
@@ -350,6 +352,47 @@ TEST_CASE("remap", "remap_testing") {
     }
   }
 
+  // Timing of the vertical remap, to compare builds with different HOMMEXX_VECTOR_SIZE.
+  // It only runs if the env var HOMMEXX_PERF_NTRIALS is set to a positive number.
+  SECTION ("remap_perf") {
+    const char* ntrials_env = std::getenv("HOMMEXX_PERF_NTRIALS");
+    const int ntrials = ntrials_env!=nullptr ? std::atoi(ntrials_env) : 0;
+    if (ntrials>0) {
+      for (auto alg : {RemapAlg::PPM_MIRRORED, RemapAlg::PPM_LIMITED_EXTRAP}) {
+        params.rsplit = 3;
+        params.remap_alg = alg;
+        params.theta_hydrostatic_mode = false;
+
+        VerticalRemapManager vrm;
+        FunctorsBuffersManager fbm;
+        fbm.request_size(vrm.requested_buffer_size());
+        fbm.allocate();
+        vrm.init_buffers(fbm);
+
+        // Re-randomize the state before each run (outside of the timed region),
+        // since remap modifies it in place.
+        double time = 0;
+        for (int n=0; n<=ntrials; ++n) {
+          elems.m_state.randomize(seed,max_pressure,hvcoord.ps0,hvcoord.hybrid_ai0,geo.m_phis);
+          elems.m_derived.randomize(seed,dp3d_min(elems.m_state.m_dp3d));
+          tracers.randomize(seed);
+          Kokkos::fence();
+          const auto start = std::chrono::steady_clock::now();
+          vrm.run_remap(0,0,1.0);
+          Kokkos::fence();
+          const auto stop = std::chrono::steady_clock::now();
+          // The first run is a warm up
+          if (n>0) {
+            time += std::chrono::duration<double>(stop - start).count();
+          }
+        }
+        std::cout << "remap perf (" << remapAlg2str(alg) << ", VECTOR_SIZE=" << VECTOR_SIZE
+                  << ", " << num_elems << " elements, " << params.qsize << " tracers): "
+                  << time/ntrials*1e6 << " us per run\n";
+      }
+    }
+  }
+
   // The tester.cpp file (where the 'main' is), inits the comm in
   // the context. When there are multiple test_cases/sections, we
   // need to make sure the context is returned in the same status